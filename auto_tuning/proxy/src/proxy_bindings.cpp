@@ -13,6 +13,13 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .value("localwoader", Kernel::localwoader)
       .value("neigh_dr", Kernel::neigh_dr)
       .value("godunov_dr", Kernel::godunov_dr)
+      .value("friction_lsw", Kernel::friction_lsw)
+      .value("friction_aging", Kernel::friction_aging)
+      .value("friction_slip", Kernel::friction_slip)
+      .value("friction_fvw", Kernel::friction_fvw)
+      .value("friction_fvw_tp", Kernel::friction_fvw_tp)
+      .value("plasticity", Kernel::plasticity)
+      .value("lts", Kernel::lts)
       .export_values();
 
   py::class_<ProxyConfig>(module, "ProxyConfig")
@@ -20,7 +27,9 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .def_readwrite("cells", &ProxyConfig::cells)
       .def_readwrite("timesteps", &ProxyConfig::timesteps)
       .def_readwrite("kernel", &ProxyConfig::kernel)
-      .def_readwrite("verbose", &ProxyConfig::verbose);
+      .def_readwrite("verbose", &ProxyConfig::verbose)
+      .def_readwrite("yield_fraction", &ProxyConfig::yieldFraction)
+      .def_readwrite("clusters", &ProxyConfig::clusters);
 
   py::class_<ProxyOutput>(module, "ProxyOutput")
       .def(py::init<>())
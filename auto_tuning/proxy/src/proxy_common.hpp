@@ -13,7 +13,14 @@ enum Kernel {
   ader,
   localwoader,
   neigh_dr,
-  godunov_dr
+  godunov_dr,
+  friction_lsw,
+  friction_aging,
+  friction_slip,
+  friction_fvw,
+  friction_fvw_tp,
+  plasticity,
+  lts
 };
 
 struct ProxyConfig {
@@ -21,6 +28,10 @@ struct ProxyConfig {
   unsigned timesteps{10};
   Kernel kernel{Kernel::all};
   bool verbose{true};
+  // fraction of the cells which yield in every time step (plasticity kernel)
+  double yieldFraction{0.1};
+  // number of time clusters with rate 2 (lts kernel)
+  unsigned clusters{2};
 };
 
 struct ProxyOutput{
@@ -93,13 +104,20 @@ struct Aux {
 
 protected:
   inline static std::unordered_map<Kernel, std::string> map{
-      {Kernel::all,         "all"},
-      {Kernel::local,       "local"},
-      {Kernel::neigh,       "neigh"},
-      {Kernel::ader,        "ader"},
-      {Kernel::localwoader, "localwoader"},
-      {Kernel::neigh_dr,    "neigh_dr"},
-      {Kernel::godunov_dr,  "godunov_dr"}
+      {Kernel::all,             "all"},
+      {Kernel::local,           "local"},
+      {Kernel::neigh,           "neigh"},
+      {Kernel::ader,            "ader"},
+      {Kernel::localwoader,     "localwoader"},
+      {Kernel::neigh_dr,        "neigh_dr"},
+      {Kernel::godunov_dr,      "godunov_dr"},
+      {Kernel::friction_lsw,    "friction_lsw"},
+      {Kernel::friction_aging,  "friction_aging"},
+      {Kernel::friction_slip,   "friction_slip"},
+      {Kernel::friction_fvw,    "friction_fvw"},
+      {Kernel::friction_fvw_tp, "friction_fvw_tp"},
+      {Kernel::plasticity,      "plasticity"},
+      {Kernel::lts,             "lts"}
   };
 
   inline static std::unordered_map<std::string, Kernel> invMap{
@@ -109,7 +127,14 @@ protected:
       {"ader", Kernel::ader},
       {"localwoader", Kernel::localwoader},
       {"neigh_dr", Kernel::neigh_dr},
-      {"godunov_dr", Kernel::godunov_dr}
+      {"godunov_dr", Kernel::godunov_dr},
+      {"friction_lsw", Kernel::friction_lsw},
+      {"friction_aging", Kernel::friction_aging},
+      {"friction_slip", Kernel::friction_slip},
+      {"friction_fvw", Kernel::friction_fvw},
+      {"friction_fvw_tp", Kernel::friction_fvw_tp},
+      {"plasticity", Kernel::plasticity},
+      {"lts", Kernel::lts}
   };
 };
 
@@ -15,6 +15,10 @@ int main(int argc, char* argv[]) {
   args.addAdditionalOption("cells", "Number of cells");
   args.addAdditionalOption("timesteps", "Number of timesteps");
   args.addAdditionalOption("kernel", kernelHelp.str());
+  args.addOption("yield-fraction", 'y', "Fraction of yielding cells (plasticity kernel)",
+                 utils::Args::Required, false);
+  args.addOption("clusters", 'c', "Number of time clusters (lts kernel)",
+                 utils::Args::Required, false);
 
   if (args.parse(argc, argv) != utils::Args::Success) {
     return -1;
@@ -24,6 +28,8 @@ int main(int argc, char* argv[]) {
   config.cells = args.getAdditionalArgument<unsigned>("cells");
   config.timesteps = args.getAdditionalArgument<unsigned>("timesteps");
   auto kernelStr = args.getAdditionalArgument<std::string>("kernel");
+  config.yieldFraction = args.getArgument<double>("yield-fraction", config.yieldFraction);
+  config.clusters = args.getArgument<unsigned>("clusters", config.clusters);
 
   try {
     config.kernel = Aux::str2kernel(kernelStr);
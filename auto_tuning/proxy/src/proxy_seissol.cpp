@@ -78,9 +78,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Kernels/Local.h>
 #include <Kernels/Neighbor.h>
 #include <Kernels/DynamicRupture.h>
+#include <Kernels/Plasticity.h>
 #include <Monitoring/FlopCounter.hpp>
 #include "utils/logger.h"
+#include <algorithm>
 #include <cassert>
+#include <stdexcept>
 
 // seissol_kernel includes
 #include "proxy_seissol_tools.hpp"
@@ -133,6 +136,25 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+    case friction_lsw:
+    case friction_aging:
+    case friction_slip:
+    case friction_fvw:
+    case friction_fvw_tp:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeFrictionLaw();
+      }
+      break;
+    case plasticity:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computePlasticityIntegration();
+      }
+      break;
+    case lts:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeLtsIntegration();
+      }
+      break;
     default:
       break;
   }
@@ -149,6 +171,19 @@ ProxyOutput runProxy(ProxyConfig config) {
     enableDynamicRupture = true;
   }
 
+  bool enableFrictionLaw = false;
+  if (config.kernel == friction_lsw || config.kernel == friction_aging || config.kernel == friction_slip ||
+      config.kernel == friction_fvw || config.kernel == friction_fvw_tp) {
+    enableDynamicRupture = true;
+    enableFrictionLaw = true;
+  }
+
+#ifdef ACL_DEVICE
+  if (enableFrictionLaw || config.kernel == plasticity || config.kernel == lts) {
+    throw std::runtime_error("The friction law, plasticity and lts kernels are only available on the host.");
+  }
+#endif
+
 #ifdef ACL_DEVICE
   deviceType &device = deviceType::getInstance();
   device.api->setDevice(0);
@@ -166,7 +201,18 @@ ProxyOutput runProxy(ProxyConfig config) {
     printf("Allocating fake data...\n");
 
   initGlobalData();
-  config.cells = initDataStructures(config.cells, enableDynamicRupture);
+  initFrictionLaw(config.kernel);
+  if (config.kernel == lts) {
+    config.cells = initLtsDataStructures(config.cells, std::max(config.clusters, 1u));
+  } else {
+    config.cells = initDataStructures(config.cells, enableDynamicRupture, config.kernel == plasticity);
+  }
+  if (enableFrictionLaw) {
+    initFaultData();
+  }
+  if (config.kernel == plasticity) {
+    initPlasticityData(config.yieldFraction);
+  }
 #ifdef ACL_DEVICE
   initDataStructuresOnDevice(enableDynamicRupture);
 #endif // ACL_DEVICE
@@ -183,6 +229,7 @@ ProxyOutput runProxy(ProxyConfig config) {
 
   // init OpenMP and LLC
   testKernel(config.kernel, 1);
+  m_numberOfYieldingCells = 0;
 
   seissol::monitoring::FlopCounter flopCounter;
 
@@ -233,6 +280,22 @@ ProxyOutput runProxy(ProxyConfig config) {
       flop_fun = &flops_drgod_actual;
       bytes_fun = &noestimate;
       break;
+    case friction_lsw:
+    case friction_aging:
+    case friction_slip:
+    case friction_fvw:
+    case friction_fvw_tp:
+      flop_fun = &flops_friction_actual;
+      bytes_fun = &bytes_friction;
+      break;
+    case plasticity:
+      flop_fun = &flops_plasticity_actual;
+      bytes_fun = &bytes_plasticity;
+      break;
+    case lts:
+      flop_fun = &flops_lts_actual;
+      bytes_fun = &bytes_lts;
+      break;
   }
  
 
@@ -258,6 +321,8 @@ ProxyOutput runProxy(ProxyConfig config) {
   output.hardwareGFlops = (static_cast<double>(actual_flops.d_hardwareFlops) * 1.e-9)/total;
   output.gibPerSecond = (bytes_estimate/(1024.0*1024.0*1024.0))/total;
 
+  m_frictionSolver.reset();
+  m_dynRup.reset();
   delete m_ltsTree;
   delete m_dynRupTree;
   delete m_allocator;
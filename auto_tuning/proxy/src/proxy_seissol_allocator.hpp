@@ -60,9 +60,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Initializer/LTS.h>
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/GlobalData.h>
+#include <Initializer/time_stepping/common.hpp>
+#include <DynamicRupture/FrictionLaws/FrictionLaws.h>
+#include <DynamicRupture/FrictionLaws/ThermalPressurization/ThermalPressurization.h>
 #include <Solver/time_stepping/MiniSeisSol.cpp>
+#include <utils/env.h>
 #include <yateto.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <unordered_set>
+#include <vector>
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -74,7 +82,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 seissol::initializer::LTSTree               *m_ltsTree{nullptr};
 seissol::initializer::LTS                   m_lts;
 seissol::initializer::LTSTree               *m_dynRupTree{nullptr};
-seissol::initializer::DynamicRupture        m_dynRup;
+std::unique_ptr<seissol::initializer::DynamicRupture> m_dynRup;
+
+seissol::initializer::parameters::DRParameters m_drParameters;
+std::unique_ptr<seissol::dr::friction_law::FrictionSolver> m_frictionSolver;
+
+unsigned m_numberOfClusters{1};
+unsigned long long m_numberOfYieldingCells{0};
+
+double m_faultTime{0.0};
+double m_faultTimeStepWidth{1e-3};
+unsigned m_drFusedBlockSize{8};
 
 GlobalData m_globalDataOnHost;
 GlobalData m_globalDataOnDevice;
@@ -110,10 +128,10 @@ void initGlobalData() {
   m_dynRupKernel.setGlobalData(globalData);
 }
 
-unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture) {
+unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture, bool enablePlasticity) {
   // init RNG
   srand48(i_cells);
-  m_lts.addTo(*m_ltsTree, false); // proxy does not use plasticity
+  m_lts.addTo(*m_ltsTree, enablePlasticity);
   m_ltsTree->setNumberOfTimeClusters(1);
   m_ltsTree->fixate();
   
@@ -130,7 +148,7 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   m_ltsTree->allocateBuckets();
   
   if (enableDynamicRupture) {
-    m_dynRup.addTo(*m_dynRupTree);
+    m_dynRup->addTo(*m_dynRupTree);
     m_dynRupTree->setNumberOfTimeClusters(1);
     m_dynRupTree->fixate();
     
@@ -162,11 +180,11 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
 
     // From dynamic rupture tree
     seissol::initializer::Layer& interior = m_dynRupTree->child(0).child<Interior>();
-    real (*imposedStatePlus)[seissol::tensor::QInterpolated::size()] = interior.var(m_dynRup.imposedStatePlus);
-    real (*fluxSolverPlus)[seissol::tensor::fluxSolver::size()]     = interior.var(m_dynRup.fluxSolverPlus);
-    real** timeDerivativePlus = interior.var(m_dynRup.timeDerivativePlus);
-    real** timeDerivativeMinus = interior.var(m_dynRup.timeDerivativeMinus);
-    DRFaceInformation* faceInformation = interior.var(m_dynRup.faceInformation);
+    real (*imposedStatePlus)[seissol::tensor::QInterpolated::size()] = interior.var(m_dynRup->imposedStatePlus);
+    real (*fluxSolverPlus)[seissol::tensor::fluxSolver::size()]     = interior.var(m_dynRup->fluxSolverPlus);
+    real** timeDerivativePlus = interior.var(m_dynRup->timeDerivativePlus);
+    real** timeDerivativeMinus = interior.var(m_dynRup->timeDerivativeMinus);
+    DRFaceInformation* faceInformation = interior.var(m_dynRup->faceInformation);
     
     /* init drMapping */
     for (unsigned cell = 0; cell < i_cells; ++cell) {
@@ -198,6 +216,324 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   return i_cells;
 }
 
+/**
+ * Sets up the dynamic rupture LTS descriptor and, for the friction kernels, the friction solver.
+ * The friction parameters follow the SCEC benchmarks TPV5 (linear slip weakening),
+ * TPV101/TPV102 (aging and slip law) and TPV104/TPV105 (fast velocity weakening without/with
+ * thermal pressurization).
+ */
+void initFrictionLaw(Kernel kernel) {
+  using namespace seissol::dr::friction_law;
+  using seissol::initializer::parameters::FrictionLawType;
+
+  m_drParameters.rsF0 = 0.6;
+  m_drParameters.rsSr0 = 1e-6;
+
+  switch (kernel) {
+    case friction_lsw:
+      m_drParameters.frictionLawType = FrictionLawType::LinearSlipWeakening;
+      m_dynRup = std::make_unique<seissol::initializer::LTSLinearSlipWeakening>();
+      m_frictionSolver = std::make_unique<LinearSlipWeakeningLaw<NoSpecialization>>(&m_drParameters);
+      break;
+    case friction_aging:
+    case friction_slip:
+      m_drParameters.rsB = 0.012;
+      m_drParameters.rsInitialSlipRate1 = 1e-12;
+      m_dynRup = std::make_unique<seissol::initializer::LTSRateAndState>();
+      if (kernel == friction_aging) {
+        m_drParameters.frictionLawType = FrictionLawType::RateAndStateAgingLaw;
+        m_frictionSolver = std::make_unique<AgingLaw<NoTP>>(&m_drParameters);
+      } else {
+        m_drParameters.frictionLawType = FrictionLawType::RateAndStateSlipLaw;
+        m_frictionSolver = std::make_unique<SlipLaw<NoTP>>(&m_drParameters);
+      }
+      break;
+    case friction_fvw:
+    case friction_fvw_tp:
+      m_drParameters.frictionLawType = FrictionLawType::RateAndStateFastVelocityWeakening;
+      m_drParameters.rsB = 0.014;
+      m_drParameters.muW = 0.2;
+      m_drParameters.rsInitialSlipRate1 = 1e-16;
+      if (kernel == friction_fvw) {
+        m_dynRup = std::make_unique<seissol::initializer::LTSRateAndStateFastVelocityWeakening>();
+        m_frictionSolver = std::make_unique<FastVelocityWeakeningLaw<NoTP>>(&m_drParameters);
+      } else {
+        m_drParameters.isThermalPressureOn = true;
+        m_drParameters.thermalDiffusivity = 1e-6;
+        m_drParameters.heatCapacity = 2.7e6;
+        m_drParameters.undrainedTPResponse = 0.1e6;
+        m_drParameters.initialTemperature = 483.15;
+        m_drParameters.initialPressure = -80e6;
+        m_dynRup = std::make_unique<seissol::initializer::LTSRateAndStateThermalPressurization>();
+        m_frictionSolver =
+            std::make_unique<FastVelocityWeakeningLaw<ThermalPressurization>>(&m_drParameters);
+      }
+      break;
+    default:
+      m_dynRup = std::make_unique<seissol::initializer::DynamicRupture>();
+      break;
+  }
+}
+
+/**
+ * Fills the fault layer with a homogeneous, pre-stressed fault. The transformation matrices are
+ * random, such that the space-time interpolation yields a non-trivial wave field.
+ */
+void initFaultData() {
+  using namespace seissol::dr::misc::quantity_indices;
+  constexpr unsigned numPaddedPoints = seissol::dr::misc::numPaddedPoints;
+
+  seissol::initializer::Layer& layer = m_dynRupTree->child(0).child<Interior>();
+  const unsigned numberOfFaces = layer.getNumberOfCells();
+
+  DRGodunovData* godunovData = layer.var(m_dynRup->godunovData);
+  seissol::model::IsotropicWaveSpeeds* waveSpeedsPlus = layer.var(m_dynRup->waveSpeedsPlus);
+  seissol::model::IsotropicWaveSpeeds* waveSpeedsMinus = layer.var(m_dynRup->waveSpeedsMinus);
+  seissol::dr::ImpedancesAndEta* impAndEta = layer.var(m_dynRup->impAndEta);
+  real (*initialStressInFaultCS)[numPaddedPoints][6] = layer.var(m_dynRup->initialStressInFaultCS);
+  real (*mu)[numPaddedPoints] = layer.var(m_dynRup->mu);
+  real (*slipRate1)[numPaddedPoints] = layer.var(m_dynRup->slipRate1);
+  bool (*ruptureTimePending)[numPaddedPoints] = layer.var(m_dynRup->ruptureTimePending);
+  bool (*dynStressTimePending)[numPaddedPoints] = layer.var(m_dynRup->dynStressTimePending);
+
+  auto* lsw = dynamic_cast<seissol::initializer::LTSLinearSlipWeakening*>(m_dynRup.get());
+  auto* rs = dynamic_cast<seissol::initializer::LTSRateAndState*>(m_dynRup.get());
+  auto* fvw = dynamic_cast<seissol::initializer::LTSRateAndStateFastVelocityWeakening*>(m_dynRup.get());
+  auto* tp = dynamic_cast<seissol::initializer::LTSRateAndStateThermalPressurization*>(m_dynRup.get());
+
+  const double normalStress = -120e6;
+  const double shearStress = (lsw != nullptr) ? 70e6 : (fvw != nullptr) ? 40e6 : 75e6;
+  const double rsA = (fvw != nullptr) ? 0.01 : 0.008;
+  const double rsSl0 = (fvw != nullptr) ? 0.4 : 0.02;
+
+  for (unsigned face = 0; face < numberOfFaces; ++face) {
+    for (unsigned i = 0; i < seissol::tensor::TinvT::size(); ++i) {
+      godunovData[face].TinvT[i] = (real)drand48();
+    }
+    for (unsigned i = 0; i < seissol::tensor::tractionPlusMatrix::size(); ++i) {
+      godunovData[face].tractionPlusMatrix[i] = (real)drand48();
+    }
+    for (unsigned i = 0; i < seissol::tensor::tractionMinusMatrix::size(); ++i) {
+      godunovData[face].tractionMinusMatrix[i] = (real)drand48();
+    }
+
+    waveSpeedsPlus[face] = waveSpeedsMinus[face] = {2670.0, 6000.0, 3464.0};
+    seissol::dr::ImpedancesAndEta& imp = impAndEta[face];
+    imp.zp = imp.zpNeig = waveSpeedsPlus[face].density * waveSpeedsPlus[face].pWaveVelocity;
+    imp.zs = imp.zsNeig = waveSpeedsPlus[face].density * waveSpeedsPlus[face].sWaveVelocity;
+    imp.invZp = imp.invZpNeig = 1.0 / imp.zp;
+    imp.invZs = imp.invZsNeig = 1.0 / imp.zs;
+    imp.etaP = 1.0 / (imp.invZp + imp.invZpNeig);
+    imp.invEtaS = imp.invZs + imp.invZsNeig;
+    imp.etaS = 1.0 / imp.invEtaS;
+
+    for (unsigned point = 0; point < numPaddedPoints; ++point) {
+      initialStressInFaultCS[face][point][XX] = normalStress;
+      initialStressInFaultCS[face][point][XY] = shearStress;
+      ruptureTimePending[face][point] = true;
+      dynStressTimePending[face][point] = true;
+    }
+  }
+
+  if (lsw != nullptr) {
+    real (*dC)[numPaddedPoints] = layer.var(lsw->dC);
+    real (*muS)[numPaddedPoints] = layer.var(lsw->muS);
+    real (*muD)[numPaddedPoints] = layer.var(lsw->muD);
+    real (*forcedRuptureTime)[numPaddedPoints] = layer.var(lsw->forcedRuptureTime);
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      for (unsigned point = 0; point < numPaddedPoints; ++point) {
+        dC[face][point] = 0.4;
+        muS[face][point] = 0.677;
+        muD[face][point] = 0.525;
+        forcedRuptureTime[face][point] = 1e10;
+        mu[face][point] = muS[face][point];
+      }
+    }
+  }
+
+  if (rs != nullptr) {
+    real (*a)[numPaddedPoints] = layer.var(rs->rsA);
+    real (*sl0)[numPaddedPoints] = layer.var(rs->rsSl0);
+    real (*stateVariable)[numPaddedPoints] = layer.var(rs->stateVariable);
+
+    // steady state for the initial slip rate, cf. RateAndStateInitializer
+    const double sr0 = m_drParameters.rsSr0;
+    const double initialSlipRate = m_drParameters.rsInitialSlipRate1;
+    const double tmp = std::abs(shearStress / (rsA * normalStress));
+    const double logSinh = std::log(std::exp(tmp) - std::exp(-tmp));
+    double state, friction;
+    if (fvw != nullptr) {
+      state = rsA * (std::log(sr0 / initialSlipRate) + logSinh);
+      friction = rsA * std::asinh(initialSlipRate * 0.5 / sr0 * std::exp(state / rsA));
+    } else {
+      const double rsB = m_drParameters.rsB;
+      state = rsSl0 / sr0 *
+              std::exp((rsA * logSinh - m_drParameters.rsF0 - rsA * std::log(initialSlipRate / sr0)) /
+                       rsB);
+      friction = rsA * std::asinh(initialSlipRate * 0.5 / sr0 *
+                                  std::exp((m_drParameters.rsF0 +
+                                            rsB * std::log(sr0 * state / rsSl0)) / rsA));
+    }
+
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      for (unsigned point = 0; point < numPaddedPoints; ++point) {
+        a[face][point] = rsA;
+        sl0[face][point] = rsSl0;
+        stateVariable[face][point] = state;
+        mu[face][point] = friction;
+        slipRate1[face][point] = initialSlipRate;
+      }
+    }
+  }
+
+  if (fvw != nullptr) {
+    real (*srW)[numPaddedPoints] = layer.var(fvw->rsSrW);
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      std::fill_n(srW[face], numPaddedPoints, 0.1);
+    }
+  }
+
+  if (tp != nullptr) {
+    real (*temperature)[numPaddedPoints] = layer.var(tp->temperature);
+    real (*pressure)[numPaddedPoints] = layer.var(tp->pressure);
+    real (*halfWidthShearZone)[numPaddedPoints] = layer.var(tp->halfWidthShearZone);
+    real (*hydraulicDiffusivity)[numPaddedPoints] = layer.var(tp->hydraulicDiffusivity);
+    for (unsigned face = 0; face < numberOfFaces; ++face) {
+      std::fill_n(temperature[face], numPaddedPoints, m_drParameters.initialTemperature);
+      std::fill_n(pressure[face], numPaddedPoints, m_drParameters.initialPressure);
+      std::fill_n(halfWidthShearZone[face], numPaddedPoints, 0.01);
+      std::fill_n(hydraulicDiffusivity[face], numPaddedPoints, 4e-4);
+    }
+  }
+  m_faultTime = 0.0;
+  m_drFusedBlockSize = utils::Env::get<unsigned>("SEISSOL_DR_FUSED_BLOCK_SIZE", 8);
+  m_dynRupKernel.setTimeStepWidth(m_faultTimeStepWidth);
+  m_frictionSolver->computeDeltaT(m_dynRupKernel.timePoints);
+}
+
+/**
+ * A random fraction of the cells is loaded beyond the yield stress and keeps yielding in every
+ * time step; the remaining cells stay elastic.
+ */
+void initPlasticityData(double yieldFraction) {
+  seissol::initializer::Layer& layer = m_ltsTree->child(0).child<Interior>();
+  PlasticityData* plasticity = layer.var(m_lts.plasticity);
+
+  const double angularFriction = std::atan(0.6);
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    const bool yields = drand48() < yieldFraction;
+    const real initialLoading[6] = {-50e6, -50e6, -50e6, yields ? (real)100e6 : (real)0.0, 0.0, 0.0};
+    std::copy_n(initialLoading, 6, plasticity[cell].initialLoading);
+    plasticity[cell].cohesionTimesCosAngularFriction = 1e6 * std::cos(angularFriction);
+    plasticity[cell].sinAngularFriction = std::sin(angularFriction);
+    plasticity[cell].mufactor = 1.0 / (2.0 * 3.2e10);
+  }
+}
+
+/**
+ * Distributes the cells evenly to numberOfClusters time clusters with rate 2. Three quarters of
+ * the faces connect cells of the same cluster, the others connect adjacent clusters. The LTS
+ * setups (buffers and/or derivatives per cell) are derived as in the LTS layout of SeisSol.
+ */
+unsigned int initLtsDataStructures(unsigned int i_cells, unsigned int numberOfClusters) {
+  // init RNG
+  srand48(i_cells);
+  m_numberOfClusters = numberOfClusters;
+  m_lts.addTo(*m_ltsTree, false);
+  m_ltsTree->setNumberOfTimeClusters(numberOfClusters);
+  m_ltsTree->fixate();
+
+  const unsigned derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+  std::vector<unsigned> clusterOffsets(numberOfClusters + 1, 0);
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    clusterOffsets[tc + 1] = (tc + 1) * i_cells / numberOfClusters;
+
+    seissol::initializer::TimeCluster& cluster = m_ltsTree->child(tc);
+    cluster.child<Ghost>().setNumberOfCells(0);
+    cluster.child<Copy>().setNumberOfCells(0);
+    cluster.child<Interior>().setNumberOfCells(clusterOffsets[tc + 1] - clusterOffsets[tc]);
+
+    seissol::initializer::Layer& layer = cluster.child<Interior>();
+    layer.setBucketSize(m_lts.buffersDerivatives,
+                        sizeof(real) * (tensor::I::size() + derivativesSize) * layer.getNumberOfCells());
+  }
+
+  m_ltsTree->allocateVariables();
+  m_ltsTree->touchVariables();
+  m_ltsTree->allocateBuckets();
+
+  // DOFs, buffers and matrices; the neighbors are replaced below
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    seissol::fakeData(m_lts, m_ltsTree->child(tc).child<Interior>());
+  }
+
+  CellLocalInformation* cellInformation = m_ltsTree->var(m_lts.cellInformation);
+  real** buffers = m_ltsTree->var(m_lts.buffers);
+  real** derivatives = m_ltsTree->var(m_lts.derivatives);
+  real* (*faceNeighbors)[4] = m_ltsTree->var(m_lts.faceNeighbors);
+
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    for (unsigned cell = clusterOffsets[tc]; cell < clusterOffsets[tc + 1]; ++cell) {
+      cellInformation[cell].clusterId = tc;
+      for (unsigned face = 0; face < 4; ++face) {
+        unsigned neighborCluster = tc;
+        if (numberOfClusters > 1 && lrand48() % 4 == 0) {
+          if (tc == 0) {
+            neighborCluster = 1;
+          } else if (tc == numberOfClusters - 1 || lrand48() % 2 == 0) {
+            neighborCluster = tc - 1;
+          } else {
+            neighborCluster = tc + 1;
+          }
+        }
+        const unsigned clusterSize = clusterOffsets[neighborCluster + 1] - clusterOffsets[neighborCluster];
+        cellInformation[cell].faceNeighborIds[face] = clusterOffsets[neighborCluster] + lrand48() % clusterSize;
+      }
+    }
+  }
+
+  for (unsigned cell = 0; cell < i_cells; ++cell) {
+    unsigned neighboringClusterIds[4];
+    for (unsigned face = 0; face < 4; ++face) {
+      neighboringClusterIds[face] = cellInformation[cellInformation[cell].faceNeighborIds[face]].clusterId;
+    }
+    cellInformation[cell].ltsSetup = seissol::initializer::time_stepping::getLtsSetup(cellInformation[cell].clusterId,
+                                                                                      neighboringClusterIds,
+                                                                                      cellInformation[cell].faceTypes,
+                                                                                      cellInformation[cell].faceNeighborIds);
+  }
+  for (unsigned cell = 0; cell < i_cells; ++cell) {
+    unsigned short neighboringSetups[4];
+    for (unsigned face = 0; face < 4; ++face) {
+      neighboringSetups[face] = cellInformation[cellInformation[cell].faceNeighborIds[face]].ltsSetup;
+    }
+    seissol::initializer::time_stepping::normalizeLtsSetup(neighboringSetups, cellInformation[cell].ltsSetup);
+  }
+
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    seissol::initializer::Layer& layer = m_ltsTree->child(tc).child<Interior>();
+    real* bucket = static_cast<real*>(layer.bucket(m_lts.buffersDerivatives));
+    real* derivativesBucket = bucket + tensor::I::size() * layer.getNumberOfCells();
+    seissol::kernels::fillWithStuff(derivativesBucket, derivativesSize * layer.getNumberOfCells(), false);
+
+    for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+      const unsigned ltsSetup = cellInformation[clusterOffsets[tc] + cell].ltsSetup;
+      buffers[clusterOffsets[tc] + cell] = ((ltsSetup >> 8) % 2 == 1) ? bucket + cell * tensor::I::size() : nullptr;
+      derivatives[clusterOffsets[tc] + cell] = ((ltsSetup >> 9) % 2 == 1) ? derivativesBucket + cell * derivativesSize : nullptr;
+    }
+  }
+
+  for (unsigned cell = 0; cell < i_cells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      const unsigned neighbor = cellInformation[cell].faceNeighborIds[face];
+      faceNeighbors[cell][face] = ((cellInformation[cell].ltsSetup >> face) % 2 == 1) ? derivatives[neighbor] : buffers[neighbor];
+      assert(faceNeighbors[cell][face] != nullptr);
+    }
+  }
+
+  return i_cells;
+}
+
 #ifdef ACL_DEVICE
 void initDataStructuresOnDevice(bool enableDynamicRupture) {
   seissol::initializer::TimeCluster& cluster = m_ltsTree->child(0);
@@ -213,14 +549,14 @@ void initDataStructuresOnDevice(bool enableDynamicRupture) {
   recorder.addRecorder(new seissol::initializer::recording::PlasticityRecorder);
   recorder.record(m_lts, layer);
   if (enableDynamicRupture) {
-    seissol::initializer::MemoryManager::deriveRequiredScratchpadMemoryForDr(*m_dynRupTree, m_dynRup);
+    seissol::initializer::MemoryManager::deriveRequiredScratchpadMemoryForDr(*m_dynRupTree, *m_dynRup);
     m_dynRupTree->allocateScratchPads();
 
     CompositeRecorder <seissol::initializer::DynamicRupture> drRecorder;
     drRecorder.addRecorder(new DynamicRuptureRecorder);
 
     auto &drLayer = m_dynRupTree->child(0).child<Interior>();
-    drRecorder.record(m_dynRup, drLayer);
+    drRecorder.record(*m_dynRup, drLayer);
   }
 }
 #endif // ACL_DEVICE
@@ -49,6 +49,44 @@ double bytes_all(unsigned int i_timesteps) {
   return bytes_local(i_timesteps) + bytes_neigh(i_timesteps);
 }
 
+// Estimate: all fault variables are touched once and the derivatives of both sides are read.
+double bytes_friction(unsigned int i_timesteps) {
+  unsigned nrOfFaces = m_dynRupTree->child(0).child<Interior>().getNumberOfCells();
+
+  double bytes = 0.0;
+  for (auto variableSize : m_dynRupTree->getVariableSizes()) {
+    bytes += static_cast<double>(variableSize);
+  }
+  bytes += 2.0 * nrOfFaces * yateto::computeFamilySize<tensor::dQ>() * sizeof(real);
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return timesteps * bytes;
+}
+
+// Every cell reads its DOFs and plasticity data, yielding cells also update the DOFs and pstrain.
+double bytes_plasticity(unsigned int i_timesteps) {
+  unsigned nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+
+  double bytesCheck = static_cast<double>(tensor::Q::size() * sizeof(real) + sizeof(PlasticityData));
+  double bytesYield = static_cast<double>((tensor::QStress::size() + 2 * (tensor::QStress::size() + tensor::QEtaModal::size())) * sizeof(real));
+  double elems = static_cast<double>(nrOfCells);
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return elems * timesteps * bytesCheck + static_cast<double>(m_numberOfYieldingCells) * bytesYield;
+}
+
+double bytes_lts(unsigned int i_timesteps) {
+  double bytes = static_cast<double>(m_timeKernel.bytesAder() + m_localKernel.bytesIntegral() + m_neighborKernel.bytesNeighborsIntegral());
+  double elems = 0.0;
+  for (unsigned tc = 0; tc < m_numberOfClusters; ++tc) {
+    // time cluster tc performs 2^(C-1-tc) steps per proxy time step
+    elems += static_cast<double>(m_ltsTree->child(tc).child<Interior>().getNumberOfCells()) * (1u << (m_numberOfClusters - 1 - tc));
+  }
+  double timesteps = static_cast<double>(i_timesteps);
+
+  return elems * timesteps * bytes;
+}
+
 double noestimate(unsigned) {
   return 0.0;
 }
@@ -104,7 +104,7 @@ seissol_flops flops_drgod_actual(unsigned int i_timesteps) {
   
   // iterate over cells
   seissol::initializer::Layer& interior = m_dynRupTree->child(0).child<Interior>();
-  DRFaceInformation* faceInformation = interior.var(m_dynRup.faceInformation);
+  DRFaceInformation* faceInformation = interior.var(m_dynRup->faceInformation);
   for (unsigned face = 0; face < interior.getNumberOfCells(); ++face) {
     long long l_drNonZeroFlops, l_drHardwareFlops;
     m_dynRupKernel.flopsGodunovState(faceInformation[face], l_drNonZeroFlops, l_drHardwareFlops);
@@ -118,6 +118,77 @@ seissol_flops flops_drgod_actual(unsigned int i_timesteps) {
   return ret;
 }
 
+// Only the space-time interpolation is counted; the friction laws do not provide flop counts.
+seissol_flops flops_friction_actual(unsigned int i_timesteps) {
+  return flops_drgod_actual(i_timesteps);
+}
+
+seissol_flops flops_plasticity_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+
+  long long l_nonZeroFlopsCheck, l_hardwareFlopsCheck, l_nonZeroFlopsYield, l_hardwareFlopsYield;
+  seissol::kernels::Plasticity::flopsPlasticity(l_nonZeroFlopsCheck, l_hardwareFlopsCheck, l_nonZeroFlopsYield, l_hardwareFlopsYield);
+
+  // every cell is checked, the yield flops are only spent in yielding cells
+  unsigned nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+  ret.d_nonZeroFlops  = l_nonZeroFlopsCheck * nrOfCells * i_timesteps + l_nonZeroFlopsYield * m_numberOfYieldingCells;
+  ret.d_hardwareFlops = l_hardwareFlopsCheck * nrOfCells * i_timesteps + l_hardwareFlopsYield * m_numberOfYieldingCells;
+
+  return ret;
+}
+
+seissol_flops flops_lts_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  ret.d_nonZeroFlops = 0.0;
+  ret.d_hardwareFlops = 0.0;
+
+  long long l_taylorNonZeroFlops, l_taylorHardwareFlops;
+  m_timeKernel.flopsTaylorExpansion(l_taylorNonZeroFlops, l_taylorHardwareFlops);
+
+  for (unsigned tc = 0; tc < m_numberOfClusters; ++tc) {
+    auto&                 layer           = m_ltsTree->child(tc).child<Interior>();
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+    CellDRMapping        (*drMapping)[4]  = layer.var(m_lts.drMapping);
+
+    long long clusterNonZeroFlops = 0, clusterHardwareFlops = 0;
+    for (unsigned l_cell = 0; l_cell < nrOfCells; ++l_cell) {
+      unsigned int l_nonZeroFlops, l_hardwareFlops;
+      long long l_drNonZeroFlops, l_drHardwareFlops;
+
+      m_timeKernel.flopsAder(l_nonZeroFlops, l_hardwareFlops);
+      clusterNonZeroFlops  += l_nonZeroFlops;
+      clusterHardwareFlops += l_hardwareFlops;
+
+      m_localKernel.flopsIntegral(cellInformation[l_cell].faceTypes, l_nonZeroFlops, l_hardwareFlops);
+      clusterNonZeroFlops  += l_nonZeroFlops;
+      clusterHardwareFlops += l_hardwareFlops;
+
+      m_neighborKernel.flopsNeighborsIntegral( cellInformation[l_cell].faceTypes, cellInformation[l_cell].faceRelations, drMapping[l_cell], l_nonZeroFlops, l_hardwareFlops, l_drNonZeroFlops, l_drHardwareFlops );
+      clusterNonZeroFlops  += l_nonZeroFlops + l_drNonZeroFlops;
+      clusterHardwareFlops += l_hardwareFlops + l_drHardwareFlops;
+
+      // time integration of the neighbors' derivatives
+      for (unsigned face = 0; face < 4; ++face) {
+        if ((cellInformation[l_cell].ltsSetup >> face) % 2 == 1) {
+          clusterNonZeroFlops  += l_taylorNonZeroFlops;
+          clusterHardwareFlops += l_taylorHardwareFlops;
+        }
+      }
+    }
+
+    // time cluster tc performs 2^(C-1-tc) steps per proxy time step
+    const unsigned clusterSteps = 1u << (m_numberOfClusters - 1 - tc);
+    ret.d_nonZeroFlops  += clusterNonZeroFlops * clusterSteps;
+    ret.d_hardwareFlops += clusterHardwareFlops * clusterSteps;
+  }
+
+  ret.d_nonZeroFlops *= i_timesteps;
+  ret.d_hardwareFlops *= i_timesteps;
+
+  return ret;
+}
+
 seissol_flops flops_local_actual(unsigned int i_timesteps) {
   seissol_flops ret;
   seissol_flops tmp;
@@ -37,6 +37,9 @@ void registerMarkers() {
         LIKWID_MARKER_REGISTER("localwoader");
         LIKWID_MARKER_REGISTER("local");
         LIKWID_MARKER_REGISTER("neighboring");
+        LIKWID_MARKER_REGISTER("friction");
+        LIKWID_MARKER_REGISTER("plasticity");
+        LIKWID_MARKER_REGISTER("lts");
     }
 }
 
@@ -203,11 +206,11 @@ namespace proxy::cpu {
   void computeDynRupGodunovState()
   {
     seissol::initializer::Layer& layerData = m_dynRupTree->child(0).child<Interior>();
-    DRFaceInformation* faceInformation = layerData.var(m_dynRup.faceInformation);
-    DRGodunovData* godunovData = layerData.var(m_dynRup.godunovData);
-    DREnergyOutput* drEnergyOutput = layerData.var(m_dynRup.drEnergyOutput);
-    real** timeDerivativePlus = layerData.var(m_dynRup.timeDerivativePlus);
-    real** timeDerivativeMinus = layerData.var(m_dynRup.timeDerivativeMinus);
+    DRFaceInformation* faceInformation = layerData.var(m_dynRup->faceInformation);
+    DRGodunovData* godunovData = layerData.var(m_dynRup->godunovData);
+    DREnergyOutput* drEnergyOutput = layerData.var(m_dynRup->drEnergyOutput);
+    real** timeDerivativePlus = layerData.var(m_dynRup->timeDerivativePlus);
+    real** timeDerivativeMinus = layerData.var(m_dynRup->timeDerivativeMinus);
     alignas(ALIGNMENT) real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
     alignas(ALIGNMENT) real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
 
@@ -228,4 +231,231 @@ namespace proxy::cpu {
                                               timeDerivativeMinus[prefetchFace] );
     }
   }
+
+  void computeFrictionLaw() {
+    seissol::initializer::Layer& layerData = m_dynRupTree->child(0).child<Interior>();
+    DRFaceInformation* faceInformation = layerData.var(m_dynRup->faceInformation);
+    DRGodunovData* godunovData = layerData.var(m_dynRup->godunovData);
+    DREnergyOutput* drEnergyOutput = layerData.var(m_dynRup->drEnergyOutput);
+    real** timeDerivativePlus = layerData.var(m_dynRup->timeDerivativePlus);
+    real** timeDerivativeMinus = layerData.var(m_dynRup->timeDerivativeMinus);
+    real (*qInterpolatedPlus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layerData.var(m_dynRup->qInterpolatedPlus);
+    real (*qInterpolatedMinus)[CONVERGENCE_ORDER][tensor::QInterpolated::size()] = layerData.var(m_dynRup->qInterpolatedMinus);
+
+    auto interpolate = [&](unsigned begin, unsigned end) {
+      for (unsigned face = begin; face < end; ++face) {
+        unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+        m_dynRupKernel.spaceTimeInterpolation(  faceInformation[face],
+                                               &m_globalDataOnHost,
+                                               &godunovData[face],
+                                               &drEnergyOutput[face],
+                                                timeDerivativePlus[face],
+                                                timeDerivativeMinus[face],
+                                                qInterpolatedPlus[face],
+                                                qInterpolatedMinus[face],
+                                                timeDerivativePlus[prefetchFace],
+                                                timeDerivativeMinus[prefetchFace] );
+      }
+    };
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("friction");
+    }
+  #endif
+    if (m_drFusedBlockSize > 0) {
+      m_frictionSolver->evaluateFused(layerData,
+                                      m_dynRup.get(),
+                                      m_faultTime,
+                                      m_dynRupKernel.timeWeights,
+                                      interpolate,
+                                      m_drFusedBlockSize);
+    } else {
+  #ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+  #endif
+      for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+        interpolate(face, face + 1);
+      }
+      m_frictionSolver->evaluate(layerData, m_dynRup.get(), m_faultTime, m_dynRupKernel.timeWeights);
+    }
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_STOP("friction");
+    }
+  #endif
+
+    m_faultTime += m_faultTimeStepWidth;
+  }
+
+  void computePlasticityIntegration() {
+    auto&                 layer           = m_ltsTree->child(0).child<Interior>();
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    real                  (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+    PlasticityData*       plasticity      = layer.var(m_lts.plasticity);
+    real                  (*pstrain)[tensor::QStress::size() + tensor::QEtaModal::size()] = layer.var(m_lts.pstrain);
+
+    // relaxation time and time step width of a typical simulation with plasticity
+    const double timeStepWidth = 1e-3;
+    const double tv = 0.05;
+    const double oneMinusIntegratingFactor = 1.0 - std::exp(-timeStepWidth / tv);
+
+    unsigned long long numberOfYieldingCells = 0;
+  #ifdef _OPENMP
+    #pragma omp parallel reduction(+:numberOfYieldingCells)
+    {
+    LIKWID_MARKER_START("plasticity");
+    #pragma omp for schedule(static)
+  #endif
+    for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+      numberOfYieldingCells += seissol::kernels::Plasticity::computePlasticity( oneMinusIntegratingFactor,
+                                                                                timeStepWidth,
+                                                                                tv,
+                                                                                &m_globalDataOnHost,
+                                                                                &plasticity[l_cell],
+                                                                                dofs[l_cell],
+                                                                                pstrain[l_cell] );
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("plasticity");
+    }
+  #endif
+    m_numberOfYieldingCells += numberOfYieldingCells;
+  }
+
+  /**
+   * Predictor of time cluster tc, cf. TimeCluster::computeLocalIntegration: the buffers of cells
+   * with larger neighbors accumulate the time integrals of two time steps.
+   */
+  void computeLtsLocalIntegration(unsigned tc, bool resetBuffers) {
+    auto&                 layer           = m_ltsTree->child(tc).child<Interior>();
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    real**                buffers                       = layer.var(m_lts.buffers);
+    real**                derivatives                   = layer.var(m_lts.derivatives);
+    const double          timeStepWidth   = seissol::miniSeisSolTimeStep * (1u << tc);
+
+    kernels::LocalData::Loader loader;
+    loader.load(m_lts, layer);
+    kernels::LocalTmp tmp(9.81);
+
+    alignas(ALIGNMENT) real l_integrationBuffer[tensor::I::size()];
+
+  #ifdef _OPENMP
+    #pragma omp parallel for private(l_integrationBuffer), firstprivate(tmp) schedule(static)
+  #endif
+    for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+      auto data = loader.entry(l_cell);
+
+      const bool buffersProvided = (data.cellInformation().ltsSetup >> 8) % 2 == 1;
+      const bool resetMyBuffers = buffersProvided && ( (data.cellInformation().ltsSetup >> 10) % 2 == 0 || resetBuffers );
+      real* l_bufferPointer = resetMyBuffers ? buffers[l_cell] : l_integrationBuffer;
+
+      m_timeKernel.computeAder(              timeStepWidth,
+                                             data,
+                                             tmp,
+                                             l_bufferPointer,
+                                             derivatives[l_cell] );
+      m_localKernel.computeIntegral(l_bufferPointer,
+                                    data,
+                                    tmp,
+                                    nullptr,
+                                    nullptr,
+                                    0,
+                                    0);
+
+      if (!resetMyBuffers && buffersProvided) {
+        for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+          buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
+        }
+      }
+    }
+  }
+
+  /**
+   * Corrector of time cluster tc. subTimeStart is the start of the time step relative to the
+   * prediction of the neighbors which provide derivatives.
+   */
+  void computeLtsNeighboringIntegration(unsigned tc, double subTimeStart) {
+    auto&                     layer                           = m_ltsTree->child(tc).child<Interior>();
+    unsigned                  nrOfCells                       = layer.getNumberOfCells();
+    real*                     (*faceNeighbors)[4]             = layer.var(m_lts.faceNeighbors);
+    CellDRMapping             (*drMapping)[4]                 = layer.var(m_lts.drMapping);
+    CellLocalInformation*       cellInformation               = layer.var(m_lts.cellInformation);
+    const double              timeStepWidth                   = seissol::miniSeisSolTimeStep * (1u << tc);
+
+    kernels::NeighborData::Loader loader;
+    loader.load(m_lts, layer);
+
+    real *l_timeIntegrated[4];
+    real *l_faceNeighbors_prefetch[4];
+
+  #ifdef _OPENMP
+    #pragma omp parallel for private(l_timeIntegrated, l_faceNeighbors_prefetch) schedule(static)
+  #endif
+    for( unsigned l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+      auto data = loader.entry(l_cell);
+      seissol::kernels::TimeCommon::computeIntegrals( m_timeKernel,
+                                                      cellInformation[l_cell].ltsSetup,
+                                                      cellInformation[l_cell].faceTypes,
+                                                      subTimeStart,
+                                                      timeStepWidth,
+                                                      faceNeighbors[l_cell],
+  #ifdef _OPENMP
+                                                      *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost.integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+  #else
+                                                      *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalDataOnHost.integrationBufferLTS),
+  #endif
+                                                      l_timeIntegrated );
+
+      l_faceNeighbors_prefetch[0] = faceNeighbors[l_cell][1];
+      l_faceNeighbors_prefetch[1] = faceNeighbors[l_cell][2];
+      l_faceNeighbors_prefetch[2] = faceNeighbors[l_cell][3];
+      l_faceNeighbors_prefetch[3] = (l_cell < (nrOfCells-1)) ? faceNeighbors[l_cell+1][0] : faceNeighbors[l_cell][3];
+
+      m_neighborKernel.computeNeighborsIntegral( data,
+                                                 drMapping[l_cell],
+                                                 l_timeIntegrated, l_faceNeighbors_prefetch
+                                                 );
+    }
+  }
+
+  /**
+   * One time step of the largest time cluster: time cluster tc performs 2^(C-1-tc) time steps of
+   * width miniSeisSolTimeStep * 2^tc. The predictions of a synchronization point are executed
+   * before the corrections.
+   */
+  void computeLtsIntegration() {
+    const unsigned largestCluster = m_numberOfClusters - 1;
+    const unsigned numberOfSubSteps = 1u << largestCluster;
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("lts");
+    }
+  #endif
+    for (unsigned step = 0; step < numberOfSubSteps; ++step) {
+      for (int tc = largestCluster; tc >= 0; --tc) {
+        if (step % (1u << tc) == 0) {
+          const unsigned clusterStep = step >> tc;
+          computeLtsLocalIntegration(tc, clusterStep % 2 == 0 || static_cast<unsigned>(tc) == largestCluster);
+        }
+      }
+      for (unsigned tc = 0; tc < m_numberOfClusters; ++tc) {
+        if ((step + 1) % (1u << tc) == 0) {
+          const unsigned clusterStep = step >> tc;
+          const double subTimeStart = (tc == largestCluster) ? 0.0 : (clusterStep % 2) * seissol::miniSeisSolTimeStep * (1u << tc);
+          computeLtsNeighboringIntegration(tc, subTimeStart);
+        }
+      }
+    }
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_STOP("lts");
+    }
+  #endif
+  }
 } // namespace proxy::cpu
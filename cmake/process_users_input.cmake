@@ -1,5 +1,6 @@
 option(HDF5 "Use HDF5 library for data output" ON)
 option(NETCDF "Use netcdf library for mesh input" ON)
+option(ZLIB "Use zlib for compressed checkpoints" ON)
 
 set(GRAPH_PARTITIONING_LIBS "parmetis" CACHE STRING "Graph partitioning library for mesh partitioning")
 set(GRAPH_PARTITIONING_LIB_OPTIONS parmetis parhip ptscotch)
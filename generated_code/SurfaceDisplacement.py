@@ -75,12 +75,16 @@ def addKernels(generator, aderdg, include_tensors, targets):
                                           alignStride=True) for depth in range(maxDepth+1)]
 
   displacementRotationMatrix = Tensor('displacementRotationMatrix', (3,3), alignStride=True)
-  subTriangleDisplacement = lambda depth: subTriangleDofs[depth]['kp'] <= \
+  subTriangleDisplacementDofs = [OptionalDimTensor('subTriangleDisplacementDofs({})'.format(depth), aderdg.Q.optName(), aderdg.Q.optSize(), aderdg.Q.optPos(), (4**depth, 3), alignStride=True) for depth in range(maxDepth+1)]
+  subTriangleDisplacement = lambda depth: subTriangleDisplacementDofs[depth]['kp'] <= \
                                           subTriangleProjectionFromFace[depth]['kl'] * aderdg.db.MV2nTo2m['lm'] * faceDisplacement['mp']
   subTriangleVelocity = lambda depth: subTriangleDofs[depth]['kp'] <= subTriangleProjection[depth]['kl'] * aderdg.Q['lq'] * aderdg.selectVelocity['qp']
 
-  generator.addFamily('subTriangleDisplacement', simpleParameterSpace(maxDepth+1), subTriangleDisplacement)
-  generator.addFamily('subTriangleVelocity', simpleParameterSpace(maxDepth+1), subTriangleVelocity)
+  # velocity and displacement of all sub triangles of a face in one go
+  generator.addFamily('subTriangleOutput', simpleParameterSpace(maxDepth+1), lambda depth: [
+    subTriangleVelocity(depth),
+    subTriangleDisplacement(depth)
+  ])
 
   rotatedFaceDisplacement = OptionalDimTensor('rotatedFaceDisplacement',
                                               aderdg.Q.optName(),
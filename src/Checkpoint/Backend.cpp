@@ -53,6 +53,10 @@
 #include "sionlib/Fault.h"
 #include "sionlib/Wavefield.h"
 #endif // USE_SIONLIB
+#ifdef USE_ZLIB
+#include "compressed/Fault.h"
+#include "compressed/Wavefield.h"
+#endif // USE_ZLIB
 
 void seissol::checkpoint::createBackend(seissol::initializer::parameters::CheckpointingBackend backend, Wavefield* &waveField, Fault* &fault)
 {
@@ -82,6 +86,15 @@ void seissol::checkpoint::createBackend(seissol::initializer::parameters::Checkp
       logError() << "SIONlib checkpoint backend unsupported";
       break;
 #endif //USE_SIONLIB
+    case seissol::initializer::parameters::CheckpointingBackend::COMPRESSED:
+#ifdef USE_ZLIB
+      waveField = new compressed::Wavefield();
+      fault = new compressed::Fault();
+      break;
+#else // USE_ZLIB
+      logError() << "Compressed checkpoint backend unsupported";
+      break;
+#endif // USE_ZLIB
     default:
       logError() << "Unsupported checkpoint backend";
   }
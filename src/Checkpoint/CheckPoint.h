@@ -45,15 +45,24 @@
 #include <mpi.h>
 #endif // USE_MPI
 
+#include <algorithm>
 #include <cstdio>
 #include <string>
 #include <unistd.h>
 #include <sys/stat.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
 #include "utils/logger.h"
 #include "utils/path.h"
 #include "utils/stringutils.h"
 
+#include "async/Config.h"
+
+#include "Kernels/precision.hpp"
+
 namespace seissol
 {
 
@@ -247,6 +256,31 @@ protected:
 		m_groupOffset -= numElems;
 	}
 
+	/**
+	 * Copies the data for an asynchronous write.
+	 *
+	 * Uses all OpenMP threads unless the executor runs in the I/O thread
+	 * next to the simulation.
+	 */
+	static void snapshotCopy(real* dest, const real* src, unsigned long count)
+	{
+#ifdef _OPENMP
+		if (async::Config::mode() != async::THREAD) {
+#pragma omp parallel
+			{
+				// Contiguous ranges per thread, to keep the copy streaming
+				const unsigned long numThreads = omp_get_num_threads();
+				const unsigned long thread = omp_get_thread_num();
+				const unsigned long begin = count * thread / numThreads;
+				const unsigned long end = count * (thread + 1) / numThreads;
+				std::copy(src + begin, src + end, dest + begin);
+			}
+			return;
+		}
+#endif // _OPENMP
+		std::copy(src, src + count, dest);
+	}
+
 	/**
 	 * Checks if a valid checkpoint exists
 	 *
@@ -0,0 +1,179 @@
+#include "GlobalLayout.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+#include "Parallel/MPI.h"
+
+#include "utils/env.h"
+
+namespace seissol::checkpoint {
+
+bool GlobalLayout::isEnabled() {
+  return utils::Env::get<bool>("SEISSOL_CHECKPOINT_PARTITION_INDEPENDENT", false);
+}
+
+bool GlobalLayout::isCompatible(KeyOrder written,
+                                int writtenPartitions,
+                                KeyOrder current,
+                                int partitions) {
+  if (written != current) {
+    return false;
+  }
+  return current == KeyOrder::File || writtenPartitions == partitions;
+}
+
+void GlobalLayout::init(const std::vector<std::uint64_t>& keys, std::size_t itemSize) {
+  const int size = seissol::MPI::mpi.size();
+  m_itemSize = itemSize;
+
+  // the key space is split evenly among the ranks
+  std::uint64_t numberOfKeys = 0;
+  for (const auto key : keys) {
+    numberOfKeys = std::max(numberOfKeys, key + 1);
+  }
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfKeys, 1, MPI_UINT64_T, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  auto owner = [&](std::uint64_t key) {
+    return static_cast<int>(key * static_cast<std::uint64_t>(size) / numberOfKeys);
+  };
+
+  // send every key only once
+  std::unordered_map<std::uint64_t, std::size_t> representatives;
+  std::vector<std::vector<std::size_t>> itemsPerRank(size);
+  m_duplicates.clear();
+  for (std::size_t item = 0; item < keys.size(); ++item) {
+    const auto [it, inserted] = representatives.emplace(keys[item], item);
+    if (inserted) {
+      itemsPerRank[owner(keys[item])].push_back(item);
+    } else {
+      m_duplicates.emplace_back(item, it->second);
+    }
+  }
+
+  m_sendItems.clear();
+  m_sendCounts.resize(size);
+  m_sendDisplacements.resize(size);
+  for (int rank = 0; rank < size; ++rank) {
+    m_sendCounts[rank] = itemsPerRank[rank].size();
+    m_sendDisplacements[rank] = m_sendItems.size();
+    m_sendItems.insert(m_sendItems.end(), itemsPerRank[rank].begin(), itemsPerRank[rank].end());
+  }
+  std::vector<std::uint64_t> sendKeys(m_sendItems.size());
+  for (std::size_t i = 0; i < m_sendItems.size(); ++i) {
+    sendKeys[i] = keys[m_sendItems[i]];
+  }
+
+  m_recvCounts.resize(size);
+  m_recvDisplacements.resize(size);
+#ifdef USE_MPI
+  MPI_Alltoall(
+      m_sendCounts.data(), 1, MPI_INT, m_recvCounts.data(), 1, MPI_INT, seissol::MPI::mpi.comm());
+#else
+  m_recvCounts = m_sendCounts;
+#endif // USE_MPI
+  std::exclusive_scan(
+      m_recvCounts.begin(), m_recvCounts.end(), m_recvDisplacements.begin(), 0);
+  std::vector<std::uint64_t> recvKeys(m_recvDisplacements.back() + m_recvCounts.back());
+#ifdef USE_MPI
+  MPI_Alltoallv(sendKeys.data(),
+                m_sendCounts.data(),
+                m_sendDisplacements.data(),
+                MPI_UINT64_T,
+                recvKeys.data(),
+                m_recvCounts.data(),
+                m_recvDisplacements.data(),
+                MPI_UINT64_T,
+                seissol::MPI::mpi.comm());
+#else
+  recvKeys = sendKeys;
+#endif // USE_MPI
+
+  // the chunk holds the received keys in ascending order; keys sent by several ranks (e.g. fault
+  // faces on partition boundaries) are stored only once
+  std::vector<std::uint64_t> chunkKeys(recvKeys);
+  std::sort(chunkKeys.begin(), chunkKeys.end());
+  chunkKeys.erase(std::unique(chunkKeys.begin(), chunkKeys.end()), chunkKeys.end());
+  m_numberOfChunkItems = chunkKeys.size();
+
+  m_recvPositions.resize(recvKeys.size());
+  for (std::size_t i = 0; i < recvKeys.size(); ++i) {
+    m_recvPositions[i] =
+        std::lower_bound(chunkKeys.begin(), chunkKeys.end(), recvKeys[i]) - chunkKeys.begin();
+  }
+}
+
+void GlobalLayout::exchange(const real* send,
+                            const std::vector<int>& sendCounts,
+                            const std::vector<int>& sendDisplacements,
+                            real* recv,
+                            const std::vector<int>& recvCounts,
+                            const std::vector<int>& recvDisplacements) const {
+#ifdef USE_MPI
+  MPI_Datatype itemType;
+  MPI_Type_contiguous(m_itemSize * sizeof(real), MPI_BYTE, &itemType);
+  MPI_Type_commit(&itemType);
+  MPI_Alltoallv(send,
+                sendCounts.data(),
+                sendDisplacements.data(),
+                itemType,
+                recv,
+                recvCounts.data(),
+                recvDisplacements.data(),
+                itemType,
+                seissol::MPI::mpi.comm());
+  MPI_Type_free(&itemType);
+#else
+  std::copy_n(send, sendCounts[0] * m_itemSize, recv);
+#endif // USE_MPI
+}
+
+void GlobalLayout::gather(const real* local, real* chunk) const {
+  std::vector<real> sendBuffer(m_sendItems.size() * m_itemSize);
+  std::vector<real> recvBuffer(m_recvPositions.size() * m_itemSize);
+
+  for (std::size_t i = 0; i < m_sendItems.size(); ++i) {
+    std::copy_n(local + m_sendItems[i] * m_itemSize, m_itemSize, &sendBuffer[i * m_itemSize]);
+  }
+
+  exchange(sendBuffer.data(),
+           m_sendCounts,
+           m_sendDisplacements,
+           recvBuffer.data(),
+           m_recvCounts,
+           m_recvDisplacements);
+
+  for (std::size_t i = 0; i < m_recvPositions.size(); ++i) {
+    std::copy_n(&recvBuffer[i * m_itemSize], m_itemSize, chunk + m_recvPositions[i] * m_itemSize);
+  }
+}
+
+void GlobalLayout::scatter(const real* chunk, real* local) const {
+  std::vector<real> sendBuffer(m_recvPositions.size() * m_itemSize);
+  std::vector<real> recvBuffer(m_sendItems.size() * m_itemSize);
+
+  for (std::size_t i = 0; i < m_recvPositions.size(); ++i) {
+    std::copy_n(chunk + m_recvPositions[i] * m_itemSize, m_itemSize, &sendBuffer[i * m_itemSize]);
+  }
+
+  // reverse direction of gather
+  exchange(sendBuffer.data(),
+           m_recvCounts,
+           m_recvDisplacements,
+           recvBuffer.data(),
+           m_sendCounts,
+           m_sendDisplacements);
+
+  for (std::size_t i = 0; i < m_sendItems.size(); ++i) {
+    std::copy_n(&recvBuffer[i * m_itemSize], m_itemSize, local + m_sendItems[i] * m_itemSize);
+  }
+  for (const auto& [item, representative] : m_duplicates) {
+    std::copy_n(local + representative * m_itemSize, m_itemSize, local + item * m_itemSize);
+  }
+}
+
+} // namespace seissol::checkpoint
@@ -0,0 +1,95 @@
+#ifndef CHECKPOINT_GLOBALLAYOUT_H
+#define CHECKPOINT_GLOBALLAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::checkpoint {
+
+/**
+ * Numbering scheme of the global keys. It is stored in the checkpoint.
+ */
+enum class KeyOrder : int {
+  /** The keys are taken from the mesh file and do not depend on the partitioning */
+  File = 1,
+  /** The keys are numbered consecutively in rank order and are only valid for the same partitioning */
+  Rank = 2
+};
+
+/**
+ * Partition-independent checkpoint layout.
+ *
+ * Every local item (a cell or a fault face) is identified by a global key. Before writing, the
+ * items are redistributed such that each rank holds a contiguous range of the key space (its
+ * "chunk"), sorted by key and without duplicates. Written with the usual per-rank file offsets,
+ * the checkpoint is therefore ordered by key, independent of the partition, and can be loaded
+ * with a different number of ranks: each rank reads its chunk and sends the items to their
+ * owners.
+ *
+ * Enable it by setting SEISSOL_CHECKPOINT_PARTITION_INDEPENDENT=1.
+ */
+class GlobalLayout {
+  public:
+  static bool isEnabled();
+
+  /**
+   * @return True if a checkpoint written with keys in order <written> on <writtenPartitions> ranks
+   *  can be loaded with keys in order <current> on <partitions> ranks. Keys in rank order are only
+   *  valid for the same number of partitions.
+   */
+  static bool
+      isCompatible(KeyOrder written, int writtenPartitions, KeyOrder current, int partitions);
+
+  /**
+   * Collective.
+   *
+   * @param keys The global key of each local item. A key may appear multiple times
+   *  (e.g. for duplicated cells); such items are written once and all of them are restored.
+   * @param itemSize Number of reals per item
+   */
+  void init(const std::vector<std::uint64_t>& keys, std::size_t itemSize);
+
+  std::size_t numberOfChunkItems() const { return m_numberOfChunkItems; }
+
+  /**
+   * Copies the local items to the chunks of their owners. Collective.
+   */
+  void gather(const real* local, real* chunk) const;
+
+  /**
+   * Copies the chunk back to all local items with the same keys. Collective.
+   */
+  void scatter(const real* chunk, real* local) const;
+
+  private:
+  void exchange(const real* send,
+                const std::vector<int>& sendCounts,
+                const std::vector<int>& sendDisplacements,
+                real* recv,
+                const std::vector<int>& recvCounts,
+                const std::vector<int>& recvDisplacements) const;
+
+  std::size_t m_itemSize{0};
+  std::size_t m_numberOfChunkItems{0};
+
+  /** Local item for each sent entry (grouped by the target rank) */
+  std::vector<std::size_t> m_sendItems;
+  std::vector<int> m_sendCounts;
+  std::vector<int> m_sendDisplacements;
+
+  /** Chunk position for each received entry (grouped by the source rank) */
+  std::vector<std::size_t> m_recvPositions;
+  std::vector<int> m_recvCounts;
+  std::vector<int> m_recvDisplacements;
+
+  /** Pairs of (item, item with the same key that is actually sent) */
+  std::vector<std::pair<std::size_t, std::size_t>> m_duplicates;
+};
+
+} // namespace seissol::checkpoint
+
+#endif // CHECKPOINT_GLOBALLAYOUT_H
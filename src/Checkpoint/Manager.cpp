@@ -58,12 +58,47 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		// Initialize the asynchronous module
 		async::Module<ManagerExecutor, CheckpointInitParam, CheckpointParam>::init();
 
+		const int rank = seissol::MPI::mpi.rank();
+
+		// Redistribute the data for partition-independent checkpoints
+		m_globalLayout = GlobalLayout::isEnabled();
+		real* drDofs[8] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
+		if (m_globalLayout) {
+			if (m_backend != seissol::initializer::parameters::HDF5)
+				logError() << "Partition-independent checkpoints are only supported by the HDF5 back-end.";
+			if (utils::Env::get<int>("SEISSOL_CHECKPOINT_BLOCK_SIZE", 1) > 1)
+				logError() << "Partition-independent checkpoints cannot be combined with SEISSOL_CHECKPOINT_BLOCK_SIZE.";
+			if (m_cellKeys.size() * m_dofsPerCell != numDofs || m_faultKeys.size() != numSides)
+				logError() << "Global keys for partition-independent checkpoints are missing.";
+
+			logInfo(rank) << "Checkpoint: Using the partition-independent layout.";
+			if (m_keyOrder == KeyOrder::Rank)
+				logWarning(rank) << "The mesh format does not provide global element ids."
+					<< "Partition-independent checkpoints can only be loaded with the same number of ranks.";
+
+			m_cellLayout.init(m_cellKeys, m_dofsPerCell);
+			m_faultLayout.init(m_faultKeys, numBndGP);
+
+			m_dofs = dofs;
+			m_dofsChunk.assign(m_cellLayout.numberOfChunkItems() * m_dofsPerCell, 0);
+			dofs = m_dofsChunk.data();
+			numDofs = m_dofsChunk.size();
+
+			for (unsigned int i = 0; i < 8; i++) {
+				m_drDofs[i] = drDofs[i];
+				m_drDofsChunk[i].assign(m_faultLayout.numberOfChunkItems() * numBndGP, 0);
+				drDofs[i] = m_drDofsChunk[i].data();
+			}
+			numSides = m_faultLayout.numberOfChunkItems();
+		}
+
 		Wavefield* waveField;
 		Fault* fault;
 		createBackend(m_backend, waveField, fault);
 
 		// Set the header
 		waveField->setHeader(m_header);
+		waveField->setKeyOrder(m_keyOrder);
 
 		// Buffer for file name
 		unsigned int id = addSyncBuffer(m_filename.c_str(), m_filename.size()+1, true);
@@ -80,15 +115,10 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 
 		id = addBuffer(dofs, numDofs * sizeof(real));
 		assert(id == DOFS);
-		id = addBuffer(mu, m_numDRDofs * sizeof(real));
+		id = addBuffer(drDofs[0], m_numDRDofs * sizeof(real));
 		assert(id == DR_DOFS0);
-		addBuffer(slipRate1, m_numDRDofs * sizeof(real));
-		addBuffer(slipRate2, m_numDRDofs * sizeof(real));
-		addBuffer(slip, m_numDRDofs * sizeof(real));
-		addBuffer(slip1, m_numDRDofs * sizeof(real));
-		addBuffer(slip2, m_numDRDofs * sizeof(real));
-		addBuffer(state, m_numDRDofs * sizeof(real));
-		addBuffer(strength, m_numDRDofs * sizeof(real));
+		for (unsigned int i = 1; i < 8; i++)
+			addBuffer(drDofs[i], m_numDRDofs * sizeof(real));
 
 		//
 		// Initialization for loading checkpoints
@@ -108,8 +138,16 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		// Load checkpoint?
 		if (exists) {
 			waveField->load(dofs);
-			fault->load(faultTimeStep, mu, slipRate1, slipRate2,
-				slip, slip1, slip2, state, strength);
+			fault->load(faultTimeStep, drDofs[0], drDofs[1], drDofs[2],
+				drDofs[3], drDofs[4], drDofs[5], drDofs[6], drDofs[7]);
+
+			if (m_globalLayout) {
+				m_cellLayout.scatter(dofs, m_dofs);
+				for (unsigned int i = 0; i < 8; i++) {
+					if (m_drDofs[i])
+						m_faultLayout.scatter(drDofs[i], m_drDofs[i]);
+				}
+			}
 		} else {
 			// Initialize header information (if not set from checkpoint)
 			m_header.clear();
@@ -129,6 +167,7 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		param.backend = m_backend;
 		param.numBndGP = numBndGP;
 		param.loaded = exists;
+		param.keyOrder = m_keyOrder;
 		callInit(param);
 
 		removeBuffer(FILENAME);
@@ -148,3 +187,13 @@ void seissol::checkpoint::Manager::setUp()
     setAffinityIfNecessary(freeCpus);
   }
 }
+
+void seissol::checkpoint::Manager::gatherGlobalLayout()
+{
+	m_cellLayout.gather(m_dofs, m_dofsChunk.data());
+	for (unsigned int i = 0; i < 8; i++) {
+		// Not all friction laws provide all variables
+		if (m_drDofs[i])
+			m_faultLayout.gather(m_drDofs[i], m_drDofsChunk[i].data());
+	}
+}
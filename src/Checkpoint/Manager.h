@@ -46,8 +46,11 @@
 
 #include <Initializer/Parameters/OutputParameters.h>
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -57,6 +60,7 @@
 #include "ManagerExecutor.h"
 #include "Wavefield.h"
 #include "Fault.h"
+#include "GlobalLayout.h"
 #include "WavefieldHeader.h"
 #include "Monitoring/Stopwatch.h"
 
@@ -92,12 +96,41 @@ private:
 	/** Stopwatch for checkpointing frontend */
 	Stopwatch m_stopwatch;
 
+	/** Global keys of the cells and fault faces (only for partition-independent checkpoints) */
+	std::vector<std::uint64_t> m_cellKeys;
+	std::vector<std::uint64_t> m_faultKeys;
+
+	/** Number of DOFs per cell */
+	unsigned int m_dofsPerCell;
+
+	/** Numbering of the global keys */
+	KeyOrder m_keyOrder;
+
+	/** True if partition-independent checkpoints are written */
+	bool m_globalLayout;
+
+	GlobalLayout m_cellLayout;
+	GlobalLayout m_faultLayout;
+
+	/** Local data (only required for partition-independent checkpoints) */
+	real* m_dofs;
+	real* m_drDofs[8];
+
+	/** The chunks of the global layout that are written by this rank */
+	std::vector<real> m_dofsChunk;
+	std::vector<real> m_drDofsChunk[8];
+
 public:
 	Manager(seissol::SeisSol& seissolInstance) :
                   seissolInstance(seissolInstance),
                   m_backend(initializer::parameters::DISABLED),
                   m_numDofs(0),
-                  m_numDRDofs(0) {}
+                  m_numDRDofs(0),
+                  m_dofsPerCell(0),
+                  m_keyOrder(KeyOrder::Rank),
+                  m_globalLayout(false),
+                  m_dofs(0L),
+                  m_drDofs{} {}
 
 	virtual ~Manager() {}
 	void setBackend(seissol::initializer::parameters::CheckpointingBackend backend)
@@ -116,6 +149,24 @@ public:
 	}
 
 
+	/**
+	 * Set the global keys required for partition-independent checkpoints.
+	 * Must be called before init().
+	 *
+	 * @param cellKeys The global key for each cell in the dofs array
+	 * @param dofsPerCell Number of DOFs per cell
+	 * @param faultKeys The global key for each face in the dynamic rupture arrays
+	 * @param keyOrder The numbering of the keys, stored in the checkpoint
+	 */
+	void setGlobalKeys(std::vector<std::uint64_t> cellKeys, unsigned int dofsPerCell,
+			std::vector<std::uint64_t> faultKeys, KeyOrder keyOrder)
+	{
+		m_cellKeys = std::move(cellKeys);
+		m_dofsPerCell = dofsPerCell;
+		m_faultKeys = std::move(faultKeys);
+		m_keyOrder = keyOrder;
+	}
+
 	/**
 	 * This is called on all ranks
 	 */
@@ -155,6 +206,10 @@ public:
 
 		m_stopwatch.start();
 
+		// Time the simulation is blocked by this checkpoint
+		Stopwatch stallStopwatch;
+		stallStopwatch.start();
+
 		const int rank = seissol::MPI::mpi.rank();
 
 		// Set current time
@@ -168,6 +223,10 @@ public:
 
 		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << '.';
 
+		if (m_globalLayout) {
+			gatherGlobalLayout();
+		}
+
 		// Send buffers
 		sendBuffer(HEADER);
 		sendBuffer(DOFS, m_numDofs * sizeof(real));
@@ -186,6 +245,7 @@ public:
 		m_stopwatch.pause();
 
 		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << ". Done.";
+		logInfo(rank) << "Checkpoint: Simulation stalled for" << stallStopwatch.stop() << "seconds.";
 	}
 
 	/**
@@ -214,6 +274,10 @@ public:
 	}
 
 private:
+	/**
+	 * Copies the local data to the chunks of the partition-independent layout
+	 */
+	void gatherGlobalLayout();
 };
 
 }
@@ -43,6 +43,7 @@
 #include "async/ExecInfo.h"
 
 #include "Backend.h"
+#include "GlobalLayout.h"
 #include "Monitoring/Stopwatch.h"
 #include "Initializer/Parameters/OutputParameters.h"
 
@@ -64,6 +65,7 @@ struct CheckpointInitParam
         seissol::initializer::parameters::CheckpointingBackend backend;
 	unsigned int numBndGP;
 	bool loaded;
+	KeyOrder keyOrder;
 };
 
 /**
@@ -107,6 +109,7 @@ public:
 
 		m_waveField->setFilename(filename);
 		m_fault->setFilename(filename);
+		m_waveField->setKeyOrder(param.keyOrder);
 
 		m_waveField->init(info.bufferSize(HEADER), info.bufferSize(DOFS) / sizeof(real));
 		m_fault->init(info.bufferSize(DR_DOFS0) / param.numBndGP / sizeof(real), param.numBndGP);
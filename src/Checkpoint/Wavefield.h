@@ -49,6 +49,7 @@
 #include "utils/logger.h"
 
 #include "CheckPoint.h"
+#include "GlobalLayout.h"
 #include "WavefieldHeader.h"
 
 #include "Initializer/preProcessorMacros.hpp"
@@ -84,13 +85,17 @@ private:
 	/** Number of cells that can be saved in one iteration (due to the 2GB limit) */
 	const unsigned int m_dofsPerIteration;
 
+	/** Numbering of the cells (only used for partition-independent checkpoints) */
+	KeyOrder m_keyOrder;
+
 public:
 	Wavefield(unsigned long identifier)
 		: CheckPoint(identifier),
 		  m_header(0L),
 		  m_dofs(0L), m_numDofs(0),
 		  m_iterations(0), m_totalIterations(0),
-		  m_dofsPerIteration((1ul<<30) / sizeof(real))
+		  m_dofsPerIteration((1ul<<30) / sizeof(real)),
+		  m_keyOrder(KeyOrder::Rank)
 	{}
 
 	virtual ~Wavefield() {}
@@ -108,6 +113,15 @@ public:
 		m_header = &header;
 	}
 
+	/**
+	 * Set the numbering of the global cell keys for partition-independent checkpoints.
+	 * Must be called before init().
+	 */
+	void setKeyOrder(KeyOrder keyOrder)
+	{
+		m_keyOrder = keyOrder;
+	}
+
 	/**
 	 * Initialize checkpointing
 	 *
@@ -254,6 +268,11 @@ protected:
 	{
 		return m_dofsPerIteration;
 	}
+
+	KeyOrder keyOrder() const
+	{
+		return m_keyOrder;
+	}
 };
 
 }
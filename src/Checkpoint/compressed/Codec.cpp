@@ -0,0 +1,264 @@
+#include "Codec.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <unistd.h>
+#include <zlib.h>
+
+#include "generated_code/init.h"
+#include "generated_code/tensor.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+namespace seissol::checkpoint::compressed {
+
+namespace {
+
+using RealBits = std::conditional_t<sizeof(real) == 8, std::uint64_t, std::uint32_t>;
+constexpr int MantissaBits = std::numeric_limits<real>::digits - 1;
+
+/**
+ * Truncates the mantissa to the given number of bits. The relative error is below 2^-keepBits.
+ */
+real truncateMantissa(real value, int keepBits) {
+  RealBits bits;
+  std::memcpy(&bits, &value, sizeof(real));
+  bits &= ~((RealBits(1) << (MantissaBits - keepBits)) - 1);
+  std::memcpy(&value, &bits, sizeof(real));
+  return value;
+}
+
+void readExactly(int file, void* buffer, std::size_t size, off_t position) {
+  char* cbuffer = static_cast<char*>(buffer);
+  while (size > 0) {
+    const ssize_t ret = pread(file, cbuffer, size, position);
+    if (ret <= 0) {
+      logError() << "Could not read compressed checkpoint:" << strerror(errno);
+    }
+    cbuffer += ret;
+    size -= ret;
+    position += ret;
+  }
+}
+
+} // namespace
+
+Codec::Codec()
+    : Codec(std::max<long>(utils::Env::get<long>("SEISSOL_CHECKPOINT_BLOCK_SIZE", 1), 0) /
+                sizeof(real),
+            utils::Env::get<int>("SEISSOL_CHECKPOINT_COMPRESSION_LEVEL", Z_BEST_SPEED),
+            utils::Env::get<double>("SEISSOL_CHECKPOINT_ERROR_BOUND", 0)) {}
+
+Codec::Codec(std::uint64_t blockSize, int level, double errorBound)
+    : m_blockSize(blockSize), m_level(level), m_keepBits(-1) {
+  if (m_blockSize <= 1) {
+    // Default: 1 MiB
+    m_blockSize = (1UL << 20) / sizeof(real);
+  }
+
+  if (errorBound > 0) {
+    m_keepBits = std::clamp(static_cast<int>(std::ceil(-std::log2(errorBound))), 0, MantissaBits);
+  }
+}
+
+void Codec::compress(const real* data,
+                     std::uint64_t count,
+                     std::vector<char>& section,
+                     bool parallel) const {
+  const auto start = std::chrono::steady_clock::now();
+
+  SectionHeader header{};
+  header.count = count;
+  header.blockSize = m_blockSize;
+  header.numBlocks = (count + m_blockSize - 1) / m_blockSize;
+  header.valueSize = sizeof(real);
+
+  const bool lossy = m_keepBits >= 0 && m_keepBits < MantissaBits && !m_lossyPattern.empty();
+
+  std::vector<std::vector<Bytef>> blocks(header.numBlocks);
+  int error = Z_OK;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (parallel) reduction(min : error)
+#endif // _OPENMP
+  for (std::uint64_t block = 0; block < header.numBlocks; ++block) {
+    const std::uint64_t first = block * m_blockSize;
+    const std::uint64_t size = std::min(m_blockSize, count - first);
+
+    // Shuffle the bytes, such that the exponents (and the truncated mantissas) are contiguous
+    std::vector<Bytef> shuffled(size * sizeof(real));
+    for (std::uint64_t i = 0; i < size; ++i) {
+      real value = data[first + i];
+      if (lossy && m_lossyPattern[(first + i) % m_lossyPattern.size()]) {
+        value = truncateMantissa(value, m_keepBits);
+      }
+      const auto* bytes = reinterpret_cast<const Bytef*>(&value);
+      for (std::size_t b = 0; b < sizeof(real); ++b) {
+        shuffled[b * size + i] = bytes[b];
+      }
+    }
+
+    uLongf compressedSize = compressBound(shuffled.size());
+    blocks[block].resize(compressedSize);
+    const int ret =
+        compress2(blocks[block].data(), &compressedSize, shuffled.data(), shuffled.size(), m_level);
+    error = std::min(error, ret);
+    blocks[block].resize(compressedSize);
+  }
+  if (error != Z_OK) {
+    logError() << "Could not compress checkpoint data (zlib error" << error << ")";
+  }
+
+  std::vector<std::uint64_t> offsets(header.numBlocks + 1);
+  for (std::uint64_t block = 0; block < header.numBlocks; ++block) {
+    offsets[block + 1] = offsets[block] + blocks[block].size();
+  }
+
+  const std::size_t tableSize = sizeof(SectionHeader) + offsets.size() * sizeof(std::uint64_t);
+  section.resize(tableSize + offsets.back());
+  std::memcpy(section.data(), &header, sizeof(SectionHeader));
+  std::memcpy(section.data() + sizeof(SectionHeader),
+              offsets.data(),
+              offsets.size() * sizeof(std::uint64_t));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (parallel)
+#endif // _OPENMP
+  for (std::uint64_t block = 0; block < header.numBlocks; ++block) {
+    std::copy(
+        blocks[block].begin(), blocks[block].end(), section.data() + tableSize + offsets[block]);
+  }
+
+  m_statistics.rawBytes += count * sizeof(real);
+  m_statistics.compressedBytes += section.size();
+  m_statistics.time +=
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Codec::write(int file, const std::vector<char>& section) {
+  const char* buffer = section.data();
+  std::size_t left = section.size();
+  while (left > 0) {
+    const ssize_t written = ::write(file, buffer, left);
+    if (written <= 0) {
+      logError() << "Could not write compressed checkpoint:" << strerror(errno);
+    }
+    buffer += written;
+    left -= written;
+  }
+}
+
+off_t Codec::read(
+    int file, off_t sectionStart, std::uint64_t offset, std::uint64_t count, real* data) {
+  SectionHeader header;
+  readExactly(file, &header, sizeof(SectionHeader), sectionStart);
+  if (header.valueSize != sizeof(real)) {
+    logError() << "The compressed checkpoint was written with a different precision.";
+  }
+  if (offset + count > header.count) {
+    logError() << "The compressed checkpoint is too small:" << header.count << "values stored,"
+               << offset + count << "values required.";
+  }
+
+  std::vector<std::uint64_t> offsets(header.numBlocks + 1);
+  readExactly(file,
+              offsets.data(),
+              offsets.size() * sizeof(std::uint64_t),
+              sectionStart + sizeof(SectionHeader));
+  const off_t dataStart =
+      sectionStart + sizeof(SectionHeader) + offsets.size() * sizeof(std::uint64_t);
+
+  if (count > 0) {
+    // Only decompress the blocks that overlap with the requested range
+    const std::uint64_t firstBlock = offset / header.blockSize;
+    const std::uint64_t lastBlock = (offset + count - 1) / header.blockSize;
+
+    int error = Z_OK;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(min : error)
+#endif // _OPENMP
+    for (std::uint64_t block = firstBlock; block <= lastBlock; ++block) {
+      const std::uint64_t first = block * header.blockSize;
+      const std::uint64_t size = std::min(header.blockSize, header.count - first);
+
+      std::vector<Bytef> compressedBlock(offsets[block + 1] - offsets[block]);
+      readExactly(file, compressedBlock.data(), compressedBlock.size(), dataStart + offsets[block]);
+
+      std::vector<Bytef> shuffled(size * sizeof(real));
+      uLongf uncompressedSize = shuffled.size();
+      const int ret = uncompress(
+          shuffled.data(), &uncompressedSize, compressedBlock.data(), compressedBlock.size());
+      error = std::min(error, uncompressedSize == shuffled.size() ? ret : Z_DATA_ERROR);
+
+      const std::uint64_t begin = std::max(first, offset);
+      const std::uint64_t end = std::min(first + size, offset + count);
+      for (std::uint64_t i = begin; i < end; ++i) {
+        real value;
+        auto* bytes = reinterpret_cast<Bytef*>(&value);
+        for (std::size_t b = 0; b < sizeof(real); ++b) {
+          bytes[b] = shuffled[b * size + (i - first)];
+        }
+        data[i - offset] = value;
+      }
+    }
+    if (error != Z_OK) {
+      logError() << "Could not decompress checkpoint data (zlib error" << error << ")";
+    }
+  }
+
+  return dataStart + offsets.back();
+}
+
+#ifdef USE_MPI
+void Codec::logStatistics(int rank, MPI_Comm comm) {
+#else  // USE_MPI
+void Codec::logStatistics(int rank) {
+#endif // USE_MPI
+  std::uint64_t bytes[2] = {m_statistics.rawBytes, m_statistics.compressedBytes};
+  double time = m_statistics.time;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, bytes, 2, MPI_UINT64_T, MPI_SUM, comm);
+  MPI_Allreduce(MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, comm);
+#endif // USE_MPI
+
+  if (bytes[1] > 0) {
+    // The throughput is limited by the slowest rank
+    const double throughput = time > 0 ? bytes[0] / time / (1 << 20) : 0;
+    logInfo(rank) << "Checkpoint backend: Compression ratio"
+                  << static_cast<double>(bytes[0]) / bytes[1] << "with" << throughput << "MiB/s.";
+  }
+
+  resetStatistics();
+}
+
+std::vector<bool> dofsLossyPattern() {
+  constexpr auto Rank = sizeof(tensor::Q::Shape) / sizeof(tensor::Q::Shape[0]);
+  constexpr auto NumBasisFunctions = tensor::Q::Shape[Rank - 2];
+  constexpr auto NumQuantities = tensor::Q::Shape[Rank - 1];
+
+  // Mark the lossy entries through the view, which knows the padding of Q
+  std::vector<real> lossy(tensor::Q::size(), 0);
+  auto view = init::Q::view::create(lossy.data());
+  for (unsigned quantity = 0; quantity < NumQuantities; ++quantity) {
+    for (unsigned basisFunction = 4; basisFunction < NumBasisFunctions; ++basisFunction) {
+#ifdef MULTIPLE_SIMULATIONS
+      for (unsigned simulation = 0; simulation < tensor::Q::Shape[0]; ++simulation) {
+        view(simulation, basisFunction, quantity) = 1;
+      }
+#else  // MULTIPLE_SIMULATIONS
+      view(basisFunction, quantity) = 1;
+#endif // MULTIPLE_SIMULATIONS
+    }
+  }
+
+  std::vector<bool> pattern(lossy.size());
+  std::transform(
+      lossy.begin(), lossy.end(), pattern.begin(), [](real value) { return value != 0; });
+  return pattern;
+}
+
+} // namespace seissol::checkpoint::compressed
@@ -0,0 +1,128 @@
+#ifndef CHECKPOINT_COMPRESSED_CODEC_H
+#define CHECKPOINT_COMPRESSED_CODEC_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <sys/types.h>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif // USE_MPI
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::checkpoint::compressed {
+
+/**
+ * Block-wise compression of real arrays.
+ *
+ * A section stores one array: a SectionHeader, the offsets of all compressed blocks (relative to
+ * the end of the offset table; numBlocks + 1 entries) and the blocks. Each block holds a fixed
+ * number of values (except for the last one), byte-shuffled and compressed with zlib. Hence, any
+ * range of the array can be read without decompressing the whole section.
+ *
+ * Optionally, selected values (e.g. the high-order modes of the DOFs) are stored with a relative
+ * error bound by truncating their mantissa before the compression.
+ */
+class Codec {
+  public:
+  struct SectionHeader {
+    std::uint64_t count;
+    std::uint64_t blockSize;
+    std::uint64_t numBlocks;
+    std::uint64_t valueSize;
+  };
+
+  struct Statistics {
+    std::uint64_t rawBytes{0};
+    std::uint64_t compressedBytes{0};
+    double time{0};
+  };
+
+  /**
+   * Reads the block size from SEISSOL_CHECKPOINT_BLOCK_SIZE, the compression level from
+   * SEISSOL_CHECKPOINT_COMPRESSION_LEVEL and the error bound from
+   * SEISSOL_CHECKPOINT_ERROR_BOUND.
+   */
+  Codec();
+
+  /**
+   * @param blockSize Number of values per block
+   * @param level The zlib compression level
+   * @param errorBound Relative error bound for lossy values (0 for lossless compression)
+   */
+  Codec(std::uint64_t blockSize, int level, double errorBound);
+
+  /**
+   * Sets the values that may be compressed lossy.
+   *
+   * @param pattern Value i is compressed lossy if pattern[i % pattern.size()] is true
+   */
+  void setLossyPattern(std::vector<bool> pattern) { m_lossyPattern = std::move(pattern); }
+
+  /**
+   * Compresses an array into a section
+   *
+   * @param parallel Use all OpenMP threads
+   */
+  void compress(const real* data,
+                std::uint64_t count,
+                std::vector<char>& section,
+                bool parallel = true) const;
+
+  /**
+   * Reads values [offset, offset + count) from a section
+   *
+   * @param file A file descriptor
+   * @param sectionStart The position of the section in the file
+   * @return The position of the end of the section
+   */
+  static off_t read(
+      int file, off_t sectionStart, std::uint64_t offset, std::uint64_t count, real* data);
+
+  /**
+   * Writes a section at the current position of the file
+   */
+  static void write(int file, const std::vector<char>& section);
+
+  /**
+   * Statistics of all compress() calls since the last reset
+   */
+  const Statistics& statistics() const { return m_statistics; }
+
+  void resetStatistics() { m_statistics = Statistics(); }
+
+  /**
+   * Logs the compression ratio and throughput of all ranks and resets the statistics.
+   * Collective if compiled with MPI.
+   */
+#ifdef USE_MPI
+  void logStatistics(int rank, MPI_Comm comm);
+#else  // USE_MPI
+  void logStatistics(int rank);
+#endif // USE_MPI
+
+  private:
+  std::uint64_t m_blockSize;
+  int m_level;
+
+  /** Number of mantissa bits stored for lossy values (negative if lossless) */
+  int m_keepBits;
+
+  std::vector<bool> m_lossyPattern;
+
+  mutable Statistics m_statistics;
+};
+
+/**
+ * The lossy pattern for the DOFs of one cell (tensor::Q): only the modes of degree 2 and higher
+ * (basis functions 4, 5, ...) are lossy. The constant and linear modes as well as the padding of Q
+ * are stored lossless.
+ */
+std::vector<bool> dofsLossyPattern();
+
+} // namespace seissol::checkpoint::compressed
+
+#endif // CHECKPOINT_COMPRESSED_CODEC_H
@@ -0,0 +1,94 @@
+#include "Fault.h"
+
+#include "async/Config.h"
+
+bool seissol::checkpoint::compressed::Fault::init(unsigned int numSides,
+                                                  unsigned int numBndGP,
+                                                  unsigned int groupSize) {
+  seissol::checkpoint::Fault::init(numSides, numBndGP, groupSize);
+
+  if (numSides == 0) {
+    return true;
+  }
+
+  return exists();
+}
+
+void seissol::checkpoint::compressed::Fault::load(int& timestepFault,
+                                                  real* mu,
+                                                  real* slipRate1,
+                                                  real* slipRate2,
+                                                  real* slip,
+                                                  real* slip1,
+                                                  real* slip2,
+                                                  real* state,
+                                                  real* strength) {
+  if (numSides() == 0) {
+    return;
+  }
+
+  logInfo(rank()) << "Loading fault checkpoint";
+
+  seissol::checkpoint::CheckPoint::setLoaded();
+
+  int file = open();
+  checkErr(file);
+
+  // Read header
+  readHeader(file, timestepFault);
+
+  real* data[NUM_VARIABLES] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
+
+  // One section per variable
+  off_t position = lseek(file, 0, SEEK_CUR);
+  checkErr(position);
+  for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
+    position = Codec::read(
+        file, position, groupOffset() * numBndGP(), numSides() * numBndGP(), data[i]);
+  }
+
+  checkErr(::close(file));
+}
+
+void seissol::checkpoint::compressed::Fault::write(int timestepFault) {
+  EPIK_TRACER("CheckPointFault_write");
+  SCOREP_USER_REGION("CheckPointFault_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+  if (numSides() == 0) {
+    return;
+  }
+
+  logInfo(rank()) << "Checkpoint backend: Writing fault.";
+
+  // Start at the beginning
+  checkErr(lseek(file(), 0, SEEK_SET));
+
+  // Write the header
+  writeHeader(file(), timestepFault);
+
+  // Save data
+  EPIK_USER_REG(r_write_wavefield, "checkpoint_write_fault");
+  SCOREP_USER_REGION_DEFINE(r_write_fault);
+  EPIK_USER_START(r_write_wavefield);
+  SCOREP_USER_REGION_BEGIN(r_write_fault, "checkpoint_write_fault", SCOREP_USER_REGION_TYPE_COMMON);
+
+  for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
+    m_codec.compress(
+        data(i), numSides() * numBndGP(), m_section, async::Config::mode() != async::THREAD);
+    Codec::write(file(), m_section);
+  }
+
+  EPIK_USER_END(r_write_fault);
+  SCOREP_USER_REGION_END(r_write_fault);
+
+  // Finalize the checkpoint
+  finalizeCheckpoint();
+
+#ifdef USE_MPI
+  m_codec.logStatistics(rank(), comm());
+#else  // USE_MPI
+  m_codec.logStatistics(rank());
+#endif // USE_MPI
+
+  logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
+}
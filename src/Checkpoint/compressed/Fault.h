@@ -0,0 +1,55 @@
+#ifndef CHECKPOINT_COMPRESSED_FAULT_H
+#define CHECKPOINT_COMPRESSED_FAULT_H
+
+#include <vector>
+
+#include "Checkpoint/Fault.h"
+#include "Checkpoint/posix/CheckPoint.h"
+#include "Codec.h"
+
+namespace seissol::checkpoint::compressed {
+
+/**
+ * Fault checkpoint with one compressed file per rank (or group). All variables are compressed
+ * lossless (no lossy pattern is set).
+ */
+class Fault : public posix::CheckPoint, virtual public seissol::checkpoint::Fault {
+  public:
+  Fault()
+      : seissol::checkpoint::CheckPoint(IDENTIFIER), seissol::checkpoint::Fault(IDENTIFIER),
+        posix::CheckPoint(IDENTIFIER, sizeof(int)) {}
+
+  bool init(unsigned int numSides, unsigned int numBndGP, unsigned int groupSize = 1) override;
+
+  void load(int& timestepFault,
+            real* mu,
+            real* slipRate1,
+            real* slipRate2,
+            real* slip,
+            real* slip1,
+            real* slip2,
+            real* state,
+            real* strength) override;
+
+  void write(int timestepFault) override;
+
+  void close() override {
+    if (numSides() == 0) {
+      return;
+    }
+
+    posix::CheckPoint::close();
+  }
+
+  private:
+  Codec m_codec;
+
+  /** Buffer for the compressed data */
+  std::vector<char> m_section;
+
+  static const unsigned long IDENTIFIER = 0xA15C2;
+};
+
+} // namespace seissol::checkpoint::compressed
+
+#endif // CHECKPOINT_COMPRESSED_FAULT_H
@@ -0,0 +1,75 @@
+#include "Wavefield.h"
+
+#include "async/Config.h"
+
+bool seissol::checkpoint::compressed::Wavefield::init(size_t headerSize,
+                                                      unsigned long numDofs,
+                                                      unsigned int groupSize) {
+  seissol::checkpoint::Wavefield::init(headerSize, numDofs, groupSize);
+
+  if (utils::Env::get<int>("SEISSOL_CHECKPOINT_DIRECT", 0)) {
+    logError() << "Direct I/O is not supported by the compressed checkpoint back-end.";
+  }
+
+  // Error-bounded compression for the modes of degree 2 and higher
+  m_codec.setLossyPattern(dofsLossyPattern());
+
+  return exists();
+}
+
+void seissol::checkpoint::compressed::Wavefield::load(real* dofs) {
+  logInfo(rank()) << "Loading wave field checkpoint";
+
+  seissol::checkpoint::CheckPoint::setLoaded();
+
+  int file = open();
+  checkErr(file);
+
+  // Read header
+  checkErr(read(file, header().data(), header().size()), header().size());
+
+  // Read the part of this rank
+  Codec::read(file, header().size(), groupOffset(), numDofs(), dofs);
+
+  checkErr(::close(file));
+}
+
+void seissol::checkpoint::compressed::Wavefield::write(const void* header, size_t headerSize) {
+  EPIK_TRACER("CheckPoint_write");
+  SCOREP_USER_REGION("CheckPoint_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+  logInfo(rank()) << "Checkpoint backend: Writing.";
+
+  // Compress first; the OpenMP threads are only available if we are not running next to the
+  // simulation
+  m_codec.compress(dofs(), numDofs(), m_section, async::Config::mode() != async::THREAD);
+
+  // Start at the beginning
+  checkErr(lseek(file(), 0, SEEK_SET));
+
+  // Write the header
+  checkErr(::write(file(), header, headerSize), headerSize);
+
+  // Save data
+  EPIK_USER_REG(r_write_wavefield, "checkpoint_write_wavefield");
+  SCOREP_USER_REGION_DEFINE(r_write_wavefield);
+  EPIK_USER_START(r_write_wavefield);
+  SCOREP_USER_REGION_BEGIN(
+      r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
+
+  Codec::write(file(), m_section);
+
+  EPIK_USER_END(r_write_wavefield);
+  SCOREP_USER_REGION_END(r_write_wavefield);
+
+  // Finalize the checkpoint
+  finalizeCheckpoint();
+
+#ifdef USE_MPI
+  m_codec.logStatistics(rank(), comm());
+#else  // USE_MPI
+  m_codec.logStatistics(rank());
+#endif // USE_MPI
+
+  logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
@@ -0,0 +1,38 @@
+#ifndef CHECKPOINT_COMPRESSED_WAVEFIELD_H
+#define CHECKPOINT_COMPRESSED_WAVEFIELD_H
+
+#include <vector>
+
+#include "Checkpoint/Wavefield.h"
+#include "Checkpoint/posix/CheckPoint.h"
+#include "Codec.h"
+
+namespace seissol::checkpoint::compressed {
+
+/**
+ * Wave field checkpoint with one compressed file per rank (or group)
+ */
+class Wavefield : public posix::CheckPoint, virtual public seissol::checkpoint::Wavefield {
+  public:
+  Wavefield()
+      : seissol::checkpoint::CheckPoint(IDENTIFIER), seissol::checkpoint::Wavefield(IDENTIFIER),
+        posix::CheckPoint(IDENTIFIER) {}
+
+  bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1) override;
+
+  void load(real* dofs) override;
+
+  void write(const void* header, size_t headerSize) override;
+
+  private:
+  Codec m_codec;
+
+  /** Buffer for the compressed data */
+  std::vector<char> m_section;
+
+  static const unsigned long IDENTIFIER = 0x7A5C2;
+};
+
+} // namespace seissol::checkpoint::compressed
+
+#endif // CHECKPOINT_COMPRESSED_WAVEFIELD_H
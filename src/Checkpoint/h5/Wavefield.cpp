@@ -46,6 +46,7 @@
 #include "utils/stringutils.h"
 
 #include "Wavefield.h"
+#include "Checkpoint/GlobalLayout.h"
 
 #ifdef USE_MPI
 #include "Checkpoint/MPIInfo.h"
@@ -199,8 +200,24 @@ bool seissol::checkpoint::h5::Wavefield::validate(hid_t h5file) const
 	// Turn of error printing
 	H5ErrHandler errHandler;
 
+	// Check the layout
+	int partitionIndependent = 0;
+	hid_t h5attr = H5Aopen(h5file, "partition_independent", H5P_DEFAULT);
+	if (h5attr >= 0) {
+		herr_t err = H5Aread(h5attr, H5T_NATIVE_INT, &partitionIndependent);
+		checkH5Err(H5Aclose(h5attr));
+		if (err < 0) {
+			logWarning(rank()) << "Could not read the layout of the checkpoint.";
+			return false;
+		}
+	}
+	if ((partitionIndependent != 0) != GlobalLayout::isEnabled()) {
+		logWarning(rank()) << "Layout of the checkpoint does not match (see SEISSOL_CHECKPOINT_PARTITION_INDEPENDENT).";
+		return false;
+	}
+
 	// Check #partitions
-	hid_t h5attr = H5Aopen(h5file, "partitions", H5P_DEFAULT);
+	h5attr = H5Aopen(h5file, "partitions", H5P_DEFAULT);
 	if (h5attr < 0) {
 		logWarning(rank()) << "Checkpoint does not have a partition attribute.";
 		return false;
@@ -209,7 +226,36 @@ bool seissol::checkpoint::h5::Wavefield::validate(hid_t h5file) const
 	int p;
 	herr_t err = H5Aread(h5attr, H5T_NATIVE_INT, &p);
 	checkH5Err(H5Aclose(h5attr));
-	if (err < 0 || p != partitions()) {
+	if (err < 0) {
+		logWarning(rank()) << "Could not read the partitions of the checkpoint.";
+		return false;
+	}
+
+	if (partitionIndependent) {
+		// The partitions may differ as long as the keys do not depend on them
+		h5attr = H5Aopen(h5file, "key_order", H5P_DEFAULT);
+		if (h5attr < 0) {
+			logWarning(rank()) << "Checkpoint does not have a key order attribute.";
+			return false;
+		}
+
+		int order;
+		err = H5Aread(h5attr, H5T_NATIVE_INT, &order);
+		checkH5Err(H5Aclose(h5attr));
+		if (err < 0) {
+			logWarning(rank()) << "Could not read the key order of the checkpoint.";
+			return false;
+		}
+
+		if (!GlobalLayout::isCompatible(static_cast<KeyOrder>(order), p, keyOrder(), partitions())) {
+			logWarning(rank()) << "The checkpoint was written with" << p << "partitions and"
+				<< (order == static_cast<int>(KeyOrder::File) ? "file order" : "rank order")
+				<< "element ids; it cannot be loaded with" << partitions() << "partitions and"
+				<< (keyOrder() == KeyOrder::File ? "file order" : "rank order")
+				<< "element ids.";
+			return false;
+		}
+	} else if (p != partitions()) {
 		logWarning(rank()) << "Partitions in checkpoint do not match.";
 		return false;
 	}
@@ -301,6 +347,23 @@ hid_t seissol::checkpoint::h5::Wavefield::initFile(int odd, const char* filename
 		checkH5Err(H5Awrite(h5partitions, H5T_NATIVE_INT, &p));
 		checkH5Err(H5Aclose(h5partitions));
 
+		// Layout
+		if (GlobalLayout::isEnabled()) {
+			hid_t h5layout = H5Acreate(h5file, "partition_independent", H5T_STD_I32LE, h5spaceScalar,
+					H5P_DEFAULT, H5P_DEFAULT);
+			checkH5Err(h5layout);
+			int partitionIndependent = 1;
+			checkH5Err(H5Awrite(h5layout, H5T_NATIVE_INT, &partitionIndependent));
+			checkH5Err(H5Aclose(h5layout));
+
+			hid_t h5keyOrder = H5Acreate(h5file, "key_order", H5T_STD_I32LE, h5spaceScalar,
+					H5P_DEFAULT, H5P_DEFAULT);
+			checkH5Err(h5keyOrder);
+			int order = static_cast<int>(keyOrder());
+			checkH5Err(H5Awrite(h5keyOrder, H5T_NATIVE_INT, &order));
+			checkH5Err(H5Aclose(h5keyOrder));
+		}
+
 		checkH5Err(H5Sclose(h5spaceScalar));
 
 		// Variable
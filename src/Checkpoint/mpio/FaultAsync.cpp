@@ -67,8 +67,8 @@ void seissol::checkpoint::mpio::FaultAsync::writePrepare(int timestepFault)
 
 	// Create copy of the data
 	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
-		memcpy(&m_dataCopy[i*numSides()*numBndGP()],
-				data(i), numSides()*numBndGP()*sizeof(real));
+		snapshotCopy(&m_dataCopy[i*numSides()*numBndGP()],
+				data(i), numSides()*numBndGP());
 
 	// Save data
 	EPIK_USER_REG(r_write_wavefield, "checkpoint_write_begin_fault");
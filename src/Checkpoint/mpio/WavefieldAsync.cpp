@@ -43,9 +43,9 @@
 
 #include "WavefieldAsync.h"
 
-bool seissol::checkpoint::mpio::WavefieldAsync::init(unsigned long numDofs, unsigned int groupSize)
+bool seissol::checkpoint::mpio::WavefieldAsync::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
 {
-	bool exists = Wavefield::init(numDofs, groupSize);
+	bool exists = Wavefield::init(headerSize, numDofs, groupSize);
 
 	m_dofsCopy = new real[numDofs];
 
@@ -61,7 +61,7 @@ void seissol::checkpoint::mpio::WavefieldAsync::writePrepare(const void* header,
 	writeHeader(header, headerSize);
 
 	// Create copy of the dofs
-	memcpy(m_dofsCopy, dofs(), numDofs()*sizeof(real));
+	snapshotCopy(m_dofsCopy, dofs(), numDofs());
 
 	// Save data
 	EPIK_USER_REG(r_write_wavefield, "checkpoint_write_begin_wavefield");
@@ -78,13 +78,13 @@ public:
 	{
 	}
 
-	bool init(unsigned long numDofs, unsigned int groupSize = 1);
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1) override;
 
-	void writePrepare(const void* header, size_t headerSize);
+	void writePrepare(const void* header, size_t headerSize) override;
 
-	void write(const void* header, size_t headerSize);
+	void write(const void* header, size_t headerSize) override;
 
-	void close();
+	void close() override;
 };
 
 #endif // USE_MPI
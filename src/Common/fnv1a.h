@@ -16,6 +16,16 @@ constexpr std::uint64_t fnv1a(char const* str, std::size_t n) {
 }
 constexpr std::uint64_t fnv1a(std::string_view str) { return fnv1a(str.data(), str.size()); }
 
+// continues the hash with the given raw bytes
+inline std::uint64_t fnv1a(std::uint64_t hash, const void* data, std::size_t size) {
+  constexpr std::uint64_t prime = 0x00000100000001b3;
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * prime;
+  }
+  return hash;
+}
+
 namespace literals {
 
 constexpr std::uint64_t operator""_fnv1a(char const* str, std::size_t n) {
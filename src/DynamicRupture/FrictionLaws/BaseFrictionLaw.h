@@ -1,6 +1,8 @@
 #ifndef SEISSOL_BASEFRICTIONLAW_H
 #define SEISSOL_BASEFRICTIONLAW_H
 
+#include <algorithm>
+
 #include <yaml-cpp/yaml.h>
 
 #include "DynamicRupture/Misc.h"
@@ -27,7 +29,6 @@ class BaseFrictionLaw : public FrictionSolver {
                 seissol::initializer::DynamicRupture const* const dynRup,
                 real fullUpdateTime,
                 const double timeWeights[CONVERGENCE_ORDER]) override {
-    SCOREP_USER_REGION_DEFINE(myRegionHandle)
     BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
 
@@ -36,105 +37,141 @@ class BaseFrictionLaw : public FrictionSolver {
 #pragma omp parallel for schedule(static)
 #endif
     for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
-      alignas(ALIGNMENT) FaultStresses faultStresses{};
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
-      common::precomputeStressFromQInterpolated(faultStresses,
-                                                impAndEta[ltsFace],
-                                                impedanceMatrices[ltsFace],
-                                                qInterpolatedPlus[ltsFace],
-                                                qInterpolatedMinus[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePreHook");
-      // define some temporary variables
-      std::array<real, misc::numPaddedPoints> stateVariableBuffer{0};
-      std::array<real, misc::numPaddedPoints> strengthBuffer{0};
-
-      static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
-      LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(myRegionHandle,
-                               "computeDynamicRuptureUpdateFrictionAndSlip",
-                               SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
-      TractionResults tractionResults = {};
-
-      // loop over sub time steps (i.e. quadrature points in time)
-      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
-        common::adjustInitialStress(initialStressInFaultCS[ltsFace],
-                                    nucleationStressInFaultCS[ltsFace],
-                                    initialPressure[ltsFace],
-                                    nucleationPressure[ltsFace],
-                                    this->mFullUpdateTime,
-                                    this->drParameters->t0,
-                                    this->deltaT[timeIndex]);
-
-        static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
-                                                           tractionResults,
-                                                           stateVariableBuffer,
-                                                           strengthBuffer,
-                                                           ltsFace,
-                                                           timeIndex);
+      evaluateFace(ltsFace, timeWeights);
+    }
+  }
+
+  /**
+   * evaluates the current friction model, directly after interpolating blocks of faces
+   */
+  void evaluateFused(seissol::initializer::Layer& layerData,
+                     seissol::initializer::DynamicRupture const* const dynRup,
+                     real fullUpdateTime,
+                     const double timeWeights[CONVERGENCE_ORDER],
+                     const FaceInterpolator& interpolate,
+                     unsigned blockSize) override {
+    BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
+    static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
+
+    const unsigned numberOfFaces = layerData.getNumberOfCells();
+    const unsigned numberOfBlocks = (numberOfFaces + blockSize - 1) / blockSize;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (unsigned block = 0; block < numberOfBlocks; ++block) {
+      const unsigned begin = block * blockSize;
+      const unsigned end = std::min(begin + blockSize, numberOfFaces);
+      interpolate(begin, end);
+      for (unsigned ltsFace = begin; ltsFace < end; ++ltsFace) {
+        evaluateFace(ltsFace, timeWeights);
       }
-      LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostHook");
-      static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
-
-      common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
-                                     ruptureTime[ltsFace],
-                                     slipRateMagnitude[ltsFace],
-                                     mFullUpdateTime);
-
-      static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
-
-      common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(myRegionHandle,
-                               "computeDynamicRupturePostcomputeImposedState",
-                               SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
-      common::postcomputeImposedStateFromNewStress(faultStresses,
-                                                   tractionResults,
-                                                   impAndEta[ltsFace],
-                                                   impedanceMatrices[ltsFace],
-                                                   imposedStatePlus[ltsFace],
-                                                   imposedStateMinus[ltsFace],
-                                                   qInterpolatedPlus[ltsFace],
-                                                   qInterpolatedMinus[ltsFace],
-                                                   timeWeights);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      if (this->drParameters->isFrictionEnergyRequired) {
-
-        if (this->drParameters->isCheckAbortCriteraEnabled) {
-          common::updateTimeSinceSlipRateBelowThreshold(
-              slipRateMagnitude[ltsFace],
-              ruptureTimePending[ltsFace],
-              energyData[ltsFace],
-              this->sumDt,
-              this->drParameters->terminatorSlipRateThreshold);
-        }
-        common::computeFrictionEnergy(energyData[ltsFace],
-                                      qInterpolatedPlus[ltsFace],
-                                      qInterpolatedMinus[ltsFace],
-                                      impAndEta[ltsFace],
-                                      timeWeights,
-                                      spaceWeights,
-                                      godunovData[ltsFace]);
+    }
+  }
+
+  private:
+  /**
+   * evaluates the current friction model on one face
+   */
+  void evaluateFace(unsigned ltsFace, const double timeWeights[CONVERGENCE_ORDER]) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    alignas(ALIGNMENT) FaultStresses faultStresses{};
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
+    common::precomputeStressFromQInterpolated(faultStresses,
+                                              impAndEta[ltsFace],
+                                              impedanceMatrices[ltsFace],
+                                              qInterpolatedPlus[ltsFace],
+                                              qInterpolatedMinus[ltsFace]);
+    LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePreHook");
+    // define some temporary variables
+    std::array<real, misc::numPaddedPoints> stateVariableBuffer{0};
+    std::array<real, misc::numPaddedPoints> strengthBuffer{0};
+
+    static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
+    LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                             "computeDynamicRuptureUpdateFrictionAndSlip",
+                             SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
+    TractionResults tractionResults = {};
+
+    // loop over sub time steps (i.e. quadrature points in time)
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; timeIndex++) {
+      common::adjustInitialStress(initialStressInFaultCS[ltsFace],
+                                  nucleationStressInFaultCS[ltsFace],
+                                  initialPressure[ltsFace],
+                                  nucleationPressure[ltsFace],
+                                  this->mFullUpdateTime,
+                                  this->drParameters->t0,
+                                  this->deltaT[timeIndex]);
+
+      static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
+                                                         tractionResults,
+                                                         stateVariableBuffer,
+                                                         strengthBuffer,
+                                                         ltsFace,
+                                                         timeIndex);
+    }
+    LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostHook");
+    static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
+
+    common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
+                                   ruptureTime[ltsFace],
+                                   slipRateMagnitude[ltsFace],
+                                   mFullUpdateTime);
+
+    static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
+
+    common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
+    LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                             "computeDynamicRupturePostcomputeImposedState",
+                             SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
+    common::postcomputeImposedStateFromNewStress(faultStresses,
+                                                 tractionResults,
+                                                 impAndEta[ltsFace],
+                                                 impedanceMatrices[ltsFace],
+                                                 imposedStatePlus[ltsFace],
+                                                 imposedStateMinus[ltsFace],
+                                                 qInterpolatedPlus[ltsFace],
+                                                 qInterpolatedMinus[ltsFace],
+                                                 timeWeights);
+    LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    if (this->drParameters->isFrictionEnergyRequired) {
+
+      if (this->drParameters->isCheckAbortCriteraEnabled) {
+        common::updateTimeSinceSlipRateBelowThreshold(
+            slipRateMagnitude[ltsFace],
+            ruptureTimePending[ltsFace],
+            energyData[ltsFace],
+            this->sumDt,
+            this->drParameters->terminatorSlipRateThreshold);
       }
+      common::computeFrictionEnergy(energyData[ltsFace],
+                                    qInterpolatedPlus[ltsFace],
+                                    qInterpolatedMinus[ltsFace],
+                                    impAndEta[ltsFace],
+                                    timeWeights,
+                                    spaceWeights,
+                                    godunovData[ltsFace]);
     }
   }
 };
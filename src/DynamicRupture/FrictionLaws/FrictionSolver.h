@@ -1,6 +1,8 @@
 #ifndef SEISSOL_FRICTIONSOLVER_H
 #define SEISSOL_FRICTIONSOLVER_H
 
+#include <functional>
+
 #include "DynamicRupture/Misc.h"
 #include "Initializer/DynamicRupture.h"
 #include "Initializer/Parameters/SeisSolParameters.h"
@@ -29,6 +31,33 @@ class FrictionSolver {
                         real fullUpdateTime,
                         const double timeWeights[CONVERGENCE_ORDER]) = 0;
 
+  /**
+   * Computes qInterpolatedPlus/Minus for the faces [begin, end) of the layer.
+   * Is called concurrently for disjoint face ranges.
+   */
+  using FaceInterpolator = std::function<void(unsigned begin, unsigned end)>;
+
+  /**
+   * Same as evaluate, but the interpolation of the faces is fused with the evaluation of the
+   * friction law: the faces are processed in blocks of blockSize, such that the interpolated
+   * values are still in cache when the friction law is evaluated.
+   * The default implementation interpolates all faces first.
+   */
+  virtual void evaluateFused(seissol::initializer::Layer& layerData,
+                             seissol::initializer::DynamicRupture const* const dynRup,
+                             real fullUpdateTime,
+                             const double timeWeights[CONVERGENCE_ORDER],
+                             const FaceInterpolator& interpolate,
+                             unsigned blockSize) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+      interpolate(face, face + 1);
+    }
+    evaluate(layerData, dynRup, fullUpdateTime, timeWeights);
+  }
+
   /**
    * compute the DeltaT from the current timePoints call this function before evaluate
    * to set the correct DeltaT
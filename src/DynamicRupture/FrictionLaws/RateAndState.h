@@ -87,6 +87,7 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
     stateVariable = layerData.var(concreteLts->stateVariable);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     tpMethod.copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
+    tpMethod.updateTimeStepFactors(layerData, this->deltaT);
   }
 
   /**
@@ -10,6 +10,9 @@ class NoTP {
                           seissol::initializer::DynamicRupture const* const dynRup,
                           real fullUpdateTime) {}
 
+  void updateTimeStepFactors(seissol::initializer::Layer& layerData,
+                             real const deltaT[CONVERGENCE_ORDER]) {}
+
   void calcFluidPressure(std::array<real, misc::numPaddedPoints>& normalStress,
                          real (*mu)[misc::numPaddedPoints],
                          std::array<real, misc::numPaddedPoints>& slipRateMagnitude,
@@ -1,5 +1,7 @@
 #include "ThermalPressurization.h"
 
+#include <algorithm>
+
 namespace seissol::dr::friction_law {
 
 static const GridPoints<misc::numberOfTPGridPoints> tpGridPoints;
@@ -21,6 +23,111 @@ void ThermalPressurization::copyLtsTreeToLocal(
   faultStrength = layerData.var(concreteLts->faultStrength);
   halfWidthShearZone = layerData.var(concreteLts->halfWidthShearZone);
   hydraulicDiffusivity = layerData.var(concreteLts->hydraulicDiffusivity);
+  tpParameterId = layerData.var(concreteLts->tpParameterId);
+}
+
+void ThermalPressurization::updateTimeStepFactors(seissol::initializer::Layer& layerData,
+                                                  real const deltaT[CONVERGENCE_ORDER]) {
+  // assign the parameter ids once per layer
+  if (indexedLayers.insert(&layerData).second) {
+    for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
+      for (unsigned pointIndex = 0; pointIndex < misc::numPaddedPoints; ++pointIndex) {
+        const auto parameter = std::make_pair(halfWidthShearZone[ltsFace][pointIndex],
+                                              hydraulicDiffusivity[ltsFace][pointIndex]);
+        auto id = parameterIds.find(parameter);
+        if (id == parameterIds.end() && parameters.size() < MaxCachedParameters) {
+          id = parameterIds.emplace(parameter, parameters.size()).first;
+          parameters.push_back(parameter);
+        }
+        tpParameterId[ltsFace][pointIndex] =
+            (id != parameterIds.end()) ? id->second : NoCachedFactors;
+      }
+    }
+  }
+
+  std::array<real, CONVERGENCE_ORDER> key;
+  std::copy(deltaT, deltaT + CONVERGENCE_ORDER, key.begin());
+
+  // the first time step width of a layer is taken as its regular one
+  auto [regular, inserted] = regularFactors.try_emplace(&layerData);
+  CachedTimeStepFactors* cache = &regular->second;
+  if (inserted || cache->deltaT == key) {
+    if (scratchLayer == &layerData) {
+      scratchLayer = nullptr;
+    }
+  } else if (scratchLayer == &layerData && scratchFactors.deltaT == key) {
+    // two consecutive steps with the same width: the regular time step width has changed
+    std::swap(regular->second, scratchFactors);
+    scratchLayer = nullptr;
+  } else {
+    cache = &scratchFactors;
+    scratchLayer = &layerData;
+  }
+
+  fillTimeStepFactors(*cache, key);
+  currentFactors = &cache->factors;
+}
+
+void ThermalPressurization::fillTimeStepFactors(
+    CachedTimeStepFactors& cache, std::array<real, CONVERGENCE_ORDER> const& deltaT) const {
+  if (cache.deltaT != deltaT) {
+    cache.deltaT = deltaT;
+    cache.factors.clear();
+  }
+
+  // compute the factors of all parameter pairs which were added since the last time
+  const unsigned first = cache.factors.size();
+  cache.factors.resize(parameters.size());
+  for (unsigned id = first; id < parameters.size(); ++id) {
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      computeTimeStepFactors(deltaT[timeIndex],
+                             parameters[id].first,
+                             parameters[id].second,
+                             cache.factors[id].thetaDecay[timeIndex],
+                             cache.factors[id].sigmaDecay[timeIndex],
+                             cache.factors[id].thetaSource[timeIndex],
+                             cache.factors[id].sigmaSource[timeIndex]);
+    }
+  }
+}
+
+void ThermalPressurization::computeTimeStepFactors(
+    real deltaT,
+    real pointHalfWidthShearZone,
+    real pointHydraulicDiffusivity,
+    real thetaDecay[misc::numberOfTPGridPoints],
+    real sigmaDecay[misc::numberOfTPGridPoints],
+    real thetaSource[misc::numberOfTPGridPoints],
+    real sigmaSource[misc::numberOfTPGridPoints]) const {
+  const real lambdaPrime = drParameters->undrainedTPResponse * drParameters->thermalDiffusivity /
+                           (pointHydraulicDiffusivity - drParameters->thermalDiffusivity);
+
+#pragma omp simd
+  for (unsigned int tpGridPointIndex = 0; tpGridPointIndex < misc::numberOfTPGridPoints;
+       tpGridPointIndex++) {
+    // Gaussian shear zone in spectral domain, normalized by w
+    // \hat{l} / w
+    const real squaredNormalizedTPGrid =
+        misc::power<2>(tpGridPoints[tpGridPointIndex] / pointHalfWidthShearZone);
+
+    // This is exp(-A dt) in Noda & Lapusta (2010) equation (10)
+    const real expTheta =
+        std::exp(-drParameters->thermalDiffusivity * deltaT * squaredNormalizedTPGrid);
+    const real expSigma = std::exp(-pointHydraulicDiffusivity * deltaT * squaredNormalizedTPGrid);
+    thetaDecay[tpGridPointIndex] = expTheta;
+    sigmaDecay[tpGridPointIndex] = expSigma;
+
+    // This is B/A * (1 - exp(-A dt)) in Noda & Lapusta (2010) equation (10) without tauV
+    // heatSource stores \exp(-\hat{l}^2 / 2) / \sqrt{2 \pi}
+    thetaSource[tpGridPointIndex] =
+        heatSource[tpGridPointIndex] /
+        (drParameters->heatCapacity * squaredNormalizedTPGrid * drParameters->thermalDiffusivity) *
+        (1.0 - expTheta);
+    sigmaSource[tpGridPointIndex] =
+        heatSource[tpGridPointIndex] * (drParameters->undrainedTPResponse + lambdaPrime) /
+        (drParameters->heatCapacity * squaredNormalizedTPGrid * pointHydraulicDiffusivity) *
+        (1.0 - expSigma);
+  }
 }
 
 void ThermalPressurization::calcFluidPressure(
@@ -70,47 +177,52 @@ void ThermalPressurization::updateTemperatureAndPressure(real slipRateMagnitude,
   const real lambdaPrime =
       drParameters->undrainedTPResponse * drParameters->thermalDiffusivity /
       (hydraulicDiffusivity[ltsFace][pointIndex] - drParameters->thermalDiffusivity);
+  const real inverseHalfWidthShearZone = 1.0 / halfWidthShearZone[ltsFace][pointIndex];
+
+  // the factors exp(-A dt) and B/A * (1 - exp(-A dt)) from Noda & Lapusta (2010) equation (10)
+  // are precomputed in updateTimeStepFactors, unless the cache is full
+  const real* pointThetaDecay;
+  const real* pointSigmaDecay;
+  const real* pointThetaSource;
+  const real* pointSigmaSource;
+  alignas(ALIGNMENT) real localFactors[4][misc::numberOfTPGridPoints];
+  const unsigned parameterId = tpParameterId[ltsFace][pointIndex];
+  if (parameterId != NoCachedFactors) {
+    const auto& factors = (*currentFactors)[parameterId];
+    pointThetaDecay = factors.thetaDecay[timeIndex];
+    pointSigmaDecay = factors.sigmaDecay[timeIndex];
+    pointThetaSource = factors.thetaSource[timeIndex];
+    pointSigmaSource = factors.sigmaSource[timeIndex];
+  } else {
+    computeTimeStepFactors(deltaT,
+                           halfWidthShearZone[ltsFace][pointIndex],
+                           hydraulicDiffusivity[ltsFace][pointIndex],
+                           localFactors[0],
+                           localFactors[1],
+                           localFactors[2],
+                           localFactors[3]);
+    pointThetaDecay = localFactors[0];
+    pointSigmaDecay = localFactors[1];
+    pointThetaSource = localFactors[2];
+    pointSigmaSource = localFactors[3];
+  }
 
-#pragma omp simd
+#pragma omp simd reduction(+ : temperatureUpdate, pressureUpdate)
   for (unsigned int tpGridPointIndex = 0; tpGridPointIndex < misc::numberOfTPGridPoints;
        tpGridPointIndex++) {
-    // Gaussian shear zone in spectral domain, normalized by w
-    // \hat{l} / w
-    const real squaredNormalizedTPGrid =
-        misc::power<2>(tpGridPoints[tpGridPointIndex] / halfWidthShearZone[ltsFace][pointIndex]);
-
-    // This is exp(-A dt) in Noda & Lapusta (2010) equation (10)
-    const real expTheta =
-        std::exp(-drParameters->thermalDiffusivity * deltaT * squaredNormalizedTPGrid);
-    const real expSigma =
-        std::exp(-hydraulicDiffusivity[ltsFace][pointIndex] * deltaT * squaredNormalizedTPGrid);
-
-    // Temperature and pressure diffusion in spectral domain over timestep
-    // This is + F(t) exp(-A dt) in equation (10)
-    const real thetaDiffusion = thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * expTheta;
-    const real sigmaDiffusion = sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * expSigma;
-
-    // Heat generation during timestep
-    // This is B/A * (1 - exp(-A dt)) in Noda & Lapusta (2010) equation (10)
-    // heatSource stores \exp(-\hat{l}^2 / 2) / \sqrt{2 \pi}
-    const real omega = tauV * heatSource[tpGridPointIndex];
-    const real thetaGeneration =
-        omega /
-        (drParameters->heatCapacity * squaredNormalizedTPGrid * drParameters->thermalDiffusivity) *
-        (1.0 - expTheta);
-    const real sigmaGeneration = omega * (drParameters->undrainedTPResponse + lambdaPrime) /
-                                 (drParameters->heatCapacity * squaredNormalizedTPGrid *
-                                  hydraulicDiffusivity[ltsFace][pointIndex]) *
-                                 (1.0 - expSigma);
-
-    // Sum both contributions up
-    thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = thetaDiffusion + thetaGeneration;
-    sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] = sigmaDiffusion + sigmaGeneration;
+    // Temperature and pressure diffusion in spectral domain over timestep plus heat generation
+    // during timestep
+    thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] =
+        thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * pointThetaDecay[tpGridPointIndex] +
+        tauV * pointThetaSource[tpGridPointIndex];
+    sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] =
+        sigmaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex] * pointSigmaDecay[tpGridPointIndex] +
+        tauV * pointSigmaSource[tpGridPointIndex];
 
     // Recover temperature and altered pressure using inverse Fourier transformation from the new
     // contribution
     const real scaledInverseFourierCoefficient =
-        tpInverseFourierCoefficients[tpGridPointIndex] / halfWidthShearZone[ltsFace][pointIndex];
+        tpInverseFourierCoefficients[tpGridPointIndex] * inverseHalfWidthShearZone;
     temperatureUpdate +=
         scaledInverseFourierCoefficient * thetaTmpBuffer[ltsFace][pointIndex][tpGridPointIndex];
     pressureUpdate +=
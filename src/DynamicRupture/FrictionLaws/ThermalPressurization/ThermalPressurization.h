@@ -2,6 +2,12 @@
 #define SEISSOL_THERMALPRESSURIZATION_H
 
 #include <array>
+#include <limits>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DynamicRupture/Misc.h"
 #include "Initializer/DynamicRupture.h"
@@ -110,6 +116,15 @@ class ThermalPressurization {
                           seissol::initializer::DynamicRupture const* const dynRup,
                           real fullUpdateTime);
 
+  /**
+   * Selects the decay and source factors for the sub time step widths deltaT. They are cached per
+   * layer for its regular time step width and per (halfWidthShearZone, hydraulicDiffusivity)
+   * pair. Other time step widths (e.g. shortened steps before a synchronization point) are
+   * computed into a single scratch entry.
+   */
+  void updateTimeStepFactors(seissol::initializer::Layer& layerData,
+                             real const deltaT[CONVERGENCE_ORDER]);
+
   /**
    * Compute thermal pressure according to Noda&Lapusta (2010) at all Gauss Points within one face
    * bool saveTmpInTP is used to save final values for Theta and Sigma in the LTS tree
@@ -136,10 +151,65 @@ class ThermalPressurization {
   real (*halfWidthShearZone)[misc::numPaddedPoints];
   real (*hydraulicDiffusivity)[misc::numPaddedPoints];
   real (*faultStrength)[misc::numPaddedPoints];
+  unsigned (*tpParameterId)[misc::numPaddedPoints];
 
   private:
   seissol::initializer::parameters::DRParameters* drParameters;
 
+  /**
+   * The factors exp(-A dt) and B/A * (1 - exp(-A dt)) (without tauV) from Noda & Lapusta (2010)
+   * equation (10) for all sub time steps.
+   */
+  struct TimeStepFactors {
+    real thetaDecay[CONVERGENCE_ORDER][misc::numberOfTPGridPoints];
+    real sigmaDecay[CONVERGENCE_ORDER][misc::numberOfTPGridPoints];
+    real thetaSource[CONVERGENCE_ORDER][misc::numberOfTPGridPoints];
+    real sigmaSource[CONVERGENCE_ORDER][misc::numberOfTPGridPoints];
+  };
+
+  /**
+   * Points with more distinct parameter pairs compute their factors on the fly, such that the
+   * cache stays small for heterogeneous parameters.
+   */
+  static constexpr unsigned MaxCachedParameters = 64;
+  static constexpr unsigned NoCachedFactors = std::numeric_limits<unsigned>::max();
+
+  //! Distinct (halfWidthShearZone, hydraulicDiffusivity) pairs and their ids
+  std::vector<std::pair<real, real>> parameters;
+  std::map<std::pair<real, real>, unsigned> parameterIds;
+  //! Layers whose tpParameterId is set
+  std::set<seissol::initializer::Layer const*> indexedLayers;
+
+  //! Factors of all parameter pairs for one set of sub time step widths
+  struct CachedTimeStepFactors {
+    std::array<real, CONVERGENCE_ORDER> deltaT{};
+    std::vector<TimeStepFactors> factors;
+  };
+
+  //! Factors for the regular time step width of each layer
+  std::unordered_map<seissol::initializer::Layer const*, CachedTimeStepFactors> regularFactors;
+  //! Factors for the last irregular time step width, and the layer that used it
+  CachedTimeStepFactors scratchFactors;
+  seissol::initializer::Layer const* scratchLayer = nullptr;
+  std::vector<TimeStepFactors> const* currentFactors = nullptr;
+
+  /**
+   * Computes the factors of all parameter pairs which are not yet in the cache for deltaT.
+   */
+  void fillTimeStepFactors(CachedTimeStepFactors& cache,
+                           std::array<real, CONVERGENCE_ORDER> const& deltaT) const;
+
+  /**
+   * Computes the decay and source factors of one parameter pair for one sub time step width.
+   */
+  void computeTimeStepFactors(real deltaT,
+                              real pointHalfWidthShearZone,
+                              real pointHydraulicDiffusivity,
+                              real thetaDecay[misc::numberOfTPGridPoints],
+                              real sigmaDecay[misc::numberOfTPGridPoints],
+                              real thetaSource[misc::numberOfTPGridPoints],
+                              real sigmaSource[misc::numberOfTPGridPoints]) const;
+
   /**
    * Compute temperature and pressure update according to Noda&Lapusta (2010) on one Gaus point.
    */
@@ -169,6 +169,28 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
   }
 }
 
+void seissol::kernels::Neighbor::computeRegularNeighborsIntegral(NeighborData& data,
+                                                                 real* i_timeIntegrated[4],
+                                                                 real* faceNeighbors_prefetch[4]) {
+  assert(reinterpret_cast<uintptr_t>(data.dofs()) % ALIGNMENT == 0);
+
+  kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
+  nfKrnl.Q = data.dofs();
+  for (unsigned int l_face = 0; l_face < 4; l_face++) {
+    assert(data.cellInformation().faceTypes[l_face] == FaceType::regular ||
+           data.cellInformation().faceTypes[l_face] == FaceType::periodic);
+    assert(reinterpret_cast<uintptr_t>(i_timeIntegrated[l_face]) % ALIGNMENT == 0 );
+    assert(data.cellInformation().faceRelations[l_face][0] < 4
+           && data.cellInformation().faceRelations[l_face][1] < 3);
+    nfKrnl.I = i_timeIntegrated[l_face];
+    nfKrnl.AminusT = data.neighboringIntegration().nAmNm1[l_face];
+    nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
+    nfKrnl.execute(data.cellInformation().faceRelations[l_face][1],
+                   data.cellInformation().faceRelations[l_face][0],
+                   l_face);
+  }
+}
+
 void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalPointersToRealsTable &table) {
 #ifdef ACL_DEVICE
   kernel::gpu_neighboringFlux neighFluxKrnl = deviceNfKrnlPrototype;
@@ -81,6 +81,9 @@ namespace seissol {
     class NeighborBase;
   }
 }
+//! Neighbor.cpp implements Neighbor::computeRegularNeighborsIntegral
+#define HAS_REGULAR_NEIGHBORS_INTEGRAL
+
 struct GlobalData;
 
 class seissol::kernels::NeighborBase {
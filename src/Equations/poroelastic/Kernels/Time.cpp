@@ -93,15 +93,14 @@ void seissol::kernels::Time::executeSTP( double                      i_timeStepW
 
   //The matrix Zinv depends on the timestep
   //If the timestep is not as expected e.g. when approaching a sync point
-  //we have to recalculate it
+  //we have to recalculate it (once per material, the factorizations are cached)
   if (i_timeStepWidth != data.localIntegration().specific.typicalTimeStepWidth) {
     auto sourceMatrix = init::ET::view::create(data.localIntegration().specific.sourceMatrix);
-    real ZinvData[NUMBER_OF_QUANTITIES][CONVERGENCE_ORDER*CONVERGENCE_ORDER];
-    model::zInvInitializerForLoop<0, NUMBER_OF_QUANTITIES, decltype(sourceMatrix)>(ZinvData, sourceMatrix, i_timeStepWidth);
+    const auto& Zinv = model::cachedZinv(sourceMatrix, i_timeStepWidth);
     for (size_t i = 0; i < NUMBER_OF_QUANTITIES; i++) {
-      krnl.Zinv(i) = ZinvData[i];
+      krnl.Zinv(i) = const_cast<real*>(Zinv.data[i]);
     }
-    // krnl.execute has to be run here: ZinvData is only allocated locally
+    // krnl.execute has to be run here: Zinv is only valid until the next cache access
     krnl.execute();
   } else {
     for (size_t i = 0; i < NUMBER_OF_QUANTITIES; i++) {
@@ -1,7 +1,10 @@
 #ifndef MODEL_POROELASTICSETUP_H_
 #define MODEL_POROELASTICSETUP_H_
 
+#include <array>
 #include <cassert>
+#include <cstring>
+#include <map>
 
 #include <Eigen/Dense>
 #include <yateto/TensorView.h>
@@ -406,6 +409,47 @@ namespace seissol {
       };
     };
 
+    struct ZinvBlock {
+      real data[NUMBER_OF_QUANTITIES][CONVERGENCE_ORDER*CONVERGENCE_ORDER];
+    };
+
+    /*
+     * Zinv only depends on the time step width and on the diagonal of the source matrix.
+     * As many cells share their material (and all cells of a cluster their time step width),
+     * the factorizations are computed once per unique combination and cached per thread.
+     * The returned reference is valid until the next call from the same thread.
+     *
+     * This only affects the cell setup and time steps which differ from the typical time step
+     * width (e.g. at synchronization points). Regular time steps use the Zinv stored in the local
+     * data and are not changed by this cache; the space-time predictor itself is still solved
+     * cell by cell.
+     */
+    template<typename Tview>
+    inline const ZinvBlock& cachedZinv(Tview &sourceMatrix, real timeStepWidth) {
+      // sourceMatrix[i,i] = 0 for i < 10, cf. calcZinv
+      using Key = std::array<real, NUMBER_OF_QUANTITIES - 9>;
+      constexpr std::size_t MaxCacheEntries = 4096;
+      thread_local std::map<Key, ZinvBlock> cache;
+
+      Key key;
+      key[0] = timeStepWidth;
+      for (size_t quantity = 10; quantity < NUMBER_OF_QUANTITIES; ++quantity) {
+        key[quantity - 9] = sourceMatrix(quantity, quantity);
+      }
+
+      auto it = cache.find(key);
+      if (it == cache.end()) {
+        // bound the memory, e.g. for varying time step widths at synchronization points
+        if (cache.size() >= MaxCacheEntries) {
+          cache.clear();
+        }
+        ZinvBlock block;
+        zInvInitializerForLoop<0, NUMBER_OF_QUANTITIES, Tview>(block.data, sourceMatrix, timeStepWidth);
+        it = cache.emplace(key, block).first;
+      }
+      return it->second;
+    }
+
     inline void initializeSpecificLocalData( PoroElasticMaterial const& material,
         real timeStepWidth,
         PoroelasticLocalData* localData )
@@ -414,7 +458,8 @@ namespace seissol {
       sourceMatrix.setZero();
       getTransposedSourceCoefficientTensor(material, sourceMatrix);
 
-      zInvInitializerForLoop<0, NUMBER_OF_QUANTITIES, decltype(sourceMatrix)>(localData->Zinv, sourceMatrix, timeStepWidth);
+      const auto& Zinv = cachedZinv(sourceMatrix, timeStepWidth);
+      std::memcpy(localData->Zinv, Zinv.data, sizeof(Zinv.data));
       std::fill(localData->G, localData->G+NUMBER_OF_QUANTITIES, 0.0);
       localData->G[10] = sourceMatrix(10, 6);
       localData->G[11] = sourceMatrix(11, 7);
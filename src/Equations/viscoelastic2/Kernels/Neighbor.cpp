@@ -135,6 +135,40 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
   nKrnl.execute();
 }
 
+void seissol::kernels::Neighbor::computeRegularNeighborsIntegral(  NeighborData&                     data,
+                                                                   real*                             i_timeIntegrated[4],
+                                                                   real*                             faceNeighbors_prefetch[4] )
+{
+  // alignment of the degrees of freedom
+  assert( ((uintptr_t)data.dofs()) % ALIGNMENT == 0 );
+
+  real Qext[tensor::Qext::size()] __attribute__((aligned(PAGESIZE_STACK))) = {};
+
+  kernel::neighbourFluxExt nfKrnl = m_nfKrnlPrototype;
+  nfKrnl.Qext = Qext;
+
+  // iterate over faces
+  for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+    assert( data.cellInformation().faceTypes[l_face] == FaceType::regular ||
+            data.cellInformation().faceTypes[l_face] == FaceType::periodic );
+    assert( ((uintptr_t)i_timeIntegrated[l_face]) % ALIGNMENT == 0 );
+    assert(data.cellInformation().faceRelations[l_face][0] < 4 && data.cellInformation().faceRelations[l_face][1] < 3);
+
+    nfKrnl.I = i_timeIntegrated[l_face];
+    nfKrnl.AminusT = data.neighboringIntegration().nAmNm1[l_face];
+    nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
+    nfKrnl.execute(data.cellInformation().faceRelations[l_face][1], data.cellInformation().faceRelations[l_face][0], l_face);
+  }
+
+  kernel::neighbour nKrnl = m_nKrnlPrototype;
+  nKrnl.Qext = Qext;
+  nKrnl.Q = data.dofs();
+  nKrnl.Qane = data.dofsAne();
+  nKrnl.w = data.neighboringIntegration().specific.w;
+
+  nKrnl.execute();
+}
+
 void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTypes[4],
                                                         const int i_neighboringIndices[4][2],
                                                         CellDRMapping const (&cellDrMapping)[4],
@@ -44,6 +44,9 @@
 
 #include <generated_code/kernel.h>
 
+//! Neighbor.cpp implements Neighbor::computeRegularNeighborsIntegral
+#define HAS_REGULAR_NEIGHBORS_INTEGRAL
+
 namespace seissol {
   namespace kernels {
     class NeighborBase {
@@ -0,0 +1,295 @@
+#include "BinaryMeshReader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Parallel/MPI.h"
+
+#include "utils/logger.h"
+
+namespace seissol::geometry {
+
+namespace {
+
+using namespace binary_mesh;
+
+std::uint64_t blockSize(const PartitionIndex& index) {
+  return index.numGlobalElementIds * sizeof(std::uint64_t) + index.numElements * sizeof(Element) +
+         index.numVertices * sizeof(VrtxCoords) +
+         index.numNeighbors * sizeof(binary_mesh::Neighbor) +
+         index.numNeighborElements * sizeof(int);
+}
+
+std::uint64_t alignBlock(std::uint64_t offset) {
+  return ((offset + BlockAlignment - 1) / BlockAlignment) * BlockAlignment;
+}
+
+void readExactly(int fd, void* buffer, std::size_t size, off_t offset, const char* meshFile) {
+  if (pread(fd, buffer, size, offset) != static_cast<ssize_t>(size)) {
+    logError() << "Could not read from binary mesh file" << meshFile << ":" << strerror(errno);
+  }
+}
+
+} // namespace
+
+BinaryMeshReader::BinaryMeshReader(int rank, int nProcs, const char* meshFile)
+    : seissol::geometry::MeshReader(rank) {
+  logInfo(rank) << "Start reading binary mesh";
+
+  const int fd = open(meshFile, O_RDONLY);
+  if (fd < 0) {
+    logError() << "Could not open binary mesh file" << meshFile << ":" << strerror(errno);
+  }
+
+  FileHeader header;
+  readExactly(fd, &header, sizeof(FileHeader), 0, meshFile);
+  if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+    logError() << meshFile << "is not a binary SeisSol mesh.";
+  }
+  if (header.version != Version || header.elementSize != sizeof(Element)) {
+    logError() << "The binary mesh" << meshFile
+               << "was written by an incompatible version of SeisSol. Please regenerate it.";
+  }
+  if (header.numberOfPartitions != static_cast<std::uint64_t>(nProcs)) {
+    logError() << "Number of partitions in the binary mesh (" << header.numberOfPartitions
+               << ") does not match the number of MPI ranks (" << nProcs << ").";
+  }
+
+  PartitionIndex index;
+  readExactly(fd,
+              &index,
+              sizeof(PartitionIndex),
+              sizeof(FileHeader) + static_cast<off_t>(rank) * sizeof(PartitionIndex),
+              meshFile);
+
+  // Map only the local block; no parsing is required
+  const std::size_t size = blockSize(index);
+
+  // Mapping beyond the end of the file results in SIGBUS on access
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0) {
+    logError() << "Could not get the size of binary mesh file" << meshFile << ":" << strerror(errno);
+  }
+  const auto fileSize = static_cast<std::uint64_t>(fileStat.st_size);
+  if (size > fileSize || index.offset > fileSize - size) {
+    logError() << "The binary mesh" << meshFile << "is truncated or corrupt (partition" << rank
+               << "ends at byte" << index.offset + size << ", but the file has" << fileSize
+               << "bytes).";
+  }
+
+  void* mapped = nullptr;
+  if (size > 0) {
+    assert(index.offset % BlockAlignment == 0);
+    mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, index.offset);
+    if (mapped == MAP_FAILED) {
+      logError() << "Could not map binary mesh file" << meshFile << ":" << strerror(errno);
+    }
+  }
+  close(fd);
+
+  const char* block = static_cast<const char*>(mapped);
+
+  // Global element ids
+  if (index.numGlobalElementIds > 0) {
+    if (index.numGlobalElementIds != index.numElements) {
+      logError() << "Number of global element ids in the binary mesh" << meshFile
+                 << "does not match the number of elements.";
+    }
+    const auto* globalIds = reinterpret_cast<const std::uint64_t*>(block);
+    m_globalElementIds.assign(globalIds, globalIds + index.numGlobalElementIds);
+    m_fileOrderElementIds = true;
+  }
+  block += index.numGlobalElementIds * sizeof(std::uint64_t);
+
+  // Elements
+  m_elements.resize(index.numElements);
+  if (index.numElements > 0) {
+    std::memcpy(m_elements.data(), block, index.numElements * sizeof(Element));
+  }
+  block += index.numElements * sizeof(Element);
+
+  // Vertices
+  m_vertices.resize(index.numVertices);
+  const auto* coords = reinterpret_cast<const VrtxCoords*>(block);
+  for (std::size_t i = 0; i < index.numVertices; ++i) {
+    std::memcpy(m_vertices[i].coords, coords[i], sizeof(VrtxCoords));
+  }
+  block += index.numVertices * sizeof(VrtxCoords);
+
+  // Boundaries (MPI neighbors)
+  const auto* neighbors = reinterpret_cast<const binary_mesh::Neighbor*>(block);
+  const auto* neighborElements =
+      reinterpret_cast<const int*>(block + index.numNeighbors * sizeof(binary_mesh::Neighbor));
+  for (std::size_t i = 0; i < index.numNeighbors; ++i) {
+    MPINeighbor neighbor;
+    neighbor.localID = neighbors[i].localID;
+    neighbor.elements.resize(neighbors[i].numElements);
+    for (std::size_t j = 0; j < neighbors[i].numElements; ++j) {
+      neighbor.elements[j].localElement = neighborElements[j];
+    }
+    neighborElements += neighbors[i].numElements;
+    m_MPINeighbors[neighbors[i].rank] = neighbor;
+  }
+
+  if (mapped != nullptr) {
+    munmap(mapped, size);
+  }
+
+  logInfo(rank) << "Finished reading mesh";
+
+  // Recompute additional information
+  findElementsPerVertex();
+}
+
+void BinaryMeshReader::findElementsPerVertex() {
+  for (const auto& element : m_elements) {
+    for (int j = 0; j < 4; j++) {
+      assert(element.vertices[j] < static_cast<int>(m_vertices.size()));
+      m_vertices[element.vertices[j]].elements.push_back(element.localId);
+    }
+  }
+}
+
+void writeBinaryMesh(const MeshReader& meshReader, const std::string& fileName) {
+  const int rank = seissol::MPI::mpi.rank();
+  const int nProcs = seissol::MPI::mpi.size();
+
+  const auto& elements = meshReader.getElements();
+  const auto& vertices = meshReader.getVertices();
+  const auto& mpiNeighbors = meshReader.getMPINeighbors();
+  const auto& globalIds = meshReader.getGlobalElementIds();
+
+  logInfo(rank) << "Writing binary mesh to" << fileName;
+
+  PartitionIndex index{};
+  // Only partition-independent ids are worth storing
+  if (meshReader.hasFileOrderElementIds()) {
+    assert(globalIds.size() == elements.size());
+    index.numGlobalElementIds = globalIds.size();
+  }
+  index.numElements = elements.size();
+  index.numVertices = vertices.size();
+  index.numNeighbors = mpiNeighbors.size();
+  for (const auto& [_, neighbor] : mpiNeighbors) {
+    index.numNeighborElements += neighbor.elements.size();
+  }
+
+  // Serialize the local block
+  std::vector<char> block(blockSize(index));
+  char* position = block.data();
+  for (std::uint64_t i = 0; i < index.numGlobalElementIds; ++i) {
+    const std::uint64_t globalId = globalIds[i];
+    std::memcpy(position, &globalId, sizeof(std::uint64_t));
+    position += sizeof(std::uint64_t);
+  }
+  if (!elements.empty()) {
+    std::memcpy(position, elements.data(), elements.size() * sizeof(Element));
+  }
+  position += elements.size() * sizeof(Element);
+  for (const auto& vertex : vertices) {
+    std::memcpy(position, vertex.coords, sizeof(VrtxCoords));
+    position += sizeof(VrtxCoords);
+  }
+  for (const auto& [neighborRank, neighbor] : mpiNeighbors) {
+    const binary_mesh::Neighbor entry{
+        neighborRank, neighbor.localID, static_cast<std::uint64_t>(neighbor.elements.size())};
+    std::memcpy(position, &entry, sizeof(binary_mesh::Neighbor));
+    position += sizeof(binary_mesh::Neighbor);
+  }
+  for (const auto& [_, neighbor] : mpiNeighbors) {
+    for (const auto& element : neighbor.elements) {
+      std::memcpy(position, &element.localElement, sizeof(int));
+      position += sizeof(int);
+    }
+  }
+  assert(position == block.data() + block.size());
+
+  FileHeader header{};
+  std::memcpy(header.magic, Magic, sizeof(Magic));
+  header.version = Version;
+  header.numberOfPartitions = nProcs;
+  header.elementSize = sizeof(Element);
+
+  // Compute the offsets of all blocks
+  const std::uint64_t dataStart =
+      alignBlock(sizeof(FileHeader) + static_cast<std::uint64_t>(nProcs) * sizeof(PartitionIndex));
+  std::uint64_t paddedSize = alignBlock(block.size());
+  std::uint64_t offset = 0;
+  std::vector<PartitionIndex> indices(nProcs);
+#ifdef USE_MPI
+  MPI_Exscan(&paddedSize, &offset, 1, MPI_UINT64_T, MPI_SUM, seissol::MPI::mpi.comm());
+  if (rank == 0) {
+    offset = 0;
+  }
+  index.offset = dataStart + offset;
+  MPI_Gather(&index,
+             sizeof(PartitionIndex),
+             MPI_BYTE,
+             indices.data(),
+             sizeof(PartitionIndex),
+             MPI_BYTE,
+             0,
+             seissol::MPI::mpi.comm());
+
+  MPI_File file;
+  if (MPI_File_open(seissol::MPI::mpi.comm(),
+                    fileName.c_str(),
+                    MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                    MPI_INFO_NULL,
+                    &file) != MPI_SUCCESS) {
+    logError() << "Could not create binary mesh file" << fileName;
+  }
+  MPI_File_set_size(file, 0);
+
+  if (rank == 0) {
+    MPI_File_write_at(file, 0, &header, sizeof(FileHeader), MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_write_at(file,
+                      sizeof(FileHeader),
+                      indices.data(),
+                      nProcs * sizeof(PartitionIndex),
+                      MPI_BYTE,
+                      MPI_STATUS_IGNORE);
+  }
+
+  // Write in chunks to stay below the int limit of MPI
+  constexpr std::size_t ChunkSize = 1UL << 30;
+  for (std::size_t written = 0; written < block.size(); written += ChunkSize) {
+    const auto count = static_cast<int>(std::min(ChunkSize, block.size() - written));
+    if (MPI_File_write_at(file,
+                          index.offset + written,
+                          block.data() + written,
+                          count,
+                          MPI_BYTE,
+                          MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+      logError() << "Could not write binary mesh file" << fileName;
+    }
+  }
+
+  MPI_File_close(&file);
+#else  // USE_MPI
+  index.offset = dataStart;
+  indices[0] = index;
+
+  std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  file.write(reinterpret_cast<const char*>(indices.data()), sizeof(PartitionIndex));
+  file.seekp(index.offset);
+  file.write(block.data(), block.size());
+  if (!file) {
+    logError() << "Could not write binary mesh file" << fileName;
+  }
+#endif // USE_MPI
+
+  logInfo(rank) << "Binary mesh written";
+}
+
+} // namespace seissol::geometry
@@ -0,0 +1,71 @@
+#ifndef BINARY_MESH_READER_H
+#define BINARY_MESH_READER_H
+
+#include <cstdint>
+#include <string>
+
+#include "MeshReader.h"
+
+namespace seissol::geometry {
+
+/**
+ * SeisSol-native, pre-partitioned mesh format.
+ *
+ * The file starts with a header and an index holding one entry per partition, followed by
+ * one page-aligned block per partition which contains the raw local arrays:
+ *   uint64_t[numGlobalElementIds], Element[numElements], VrtxCoords[numVertices],
+ *   Neighbor[numNeighbors], int[numNeighborElements]
+ * Thus, every rank only maps and copies its own block; the startup cost scales with the local
+ * mesh size only. The file is written by SeisSol itself (see writeBinaryMesh), e.g. after
+ * partitioning a PUML mesh with the same number of ranks.
+ * The global element ids are only stored if the original mesh provides them (in file order);
+ * otherwise, numGlobalElementIds is 0.
+ */
+namespace binary_mesh {
+struct FileHeader {
+  char magic[8];
+  std::uint64_t version;
+  std::uint64_t numberOfPartitions;
+  std::uint64_t elementSize;
+};
+
+struct PartitionIndex {
+  std::uint64_t offset;
+  std::uint64_t numGlobalElementIds;
+  std::uint64_t numElements;
+  std::uint64_t numVertices;
+  std::uint64_t numNeighbors;
+  std::uint64_t numNeighborElements;
+};
+
+struct Neighbor {
+  std::int32_t rank;
+  std::int32_t localID;
+  std::uint64_t numElements;
+};
+
+constexpr char Magic[8] = {'S', 'S', 'B', 'M', 'E', 'S', 'H', '\0'};
+constexpr std::uint64_t Version = 2;
+constexpr std::uint64_t BlockAlignment = 4096;
+} // namespace binary_mesh
+
+class BinaryMeshReader : public seissol::geometry::MeshReader {
+  public:
+  BinaryMeshReader(int rank, int nProcs, const char* meshFile);
+
+  private:
+  /**
+   * Finds all locals elements for each vertex
+   */
+  void findElementsPerVertex();
+};
+
+/**
+ * Writes the (local part of the) mesh in the binary format. Collective over all ranks.
+ * Needs to be called before any post-processing of the mesh (displacement, scaling, faults).
+ */
+void writeBinaryMesh(const MeshReader& meshReader, const std::string& fileName);
+
+} // namespace seissol::geometry
+
+#endif // BINARY_MESH_READER_H
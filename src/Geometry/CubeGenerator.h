@@ -40,55 +40,27 @@
 #ifndef CUBEGENERATOR_H
 #define CUBEGENERATOR_H
 
-#include <algorithm>
-#include <cstring>
-#include <map>
-#include <utility>
-#include <vector>
-
-#include <omp.h>
-
-#include "utils/logger.h"
-
 #include "MeshReader.h"
 #include "Initializer/Parameters/CubeGeneratorParameters.h"
 
 namespace seissol::geometry {
 
+/**
+ * Generates a cube mesh of tetrahedra (5 per cube).
+ *
+ * Each rank only builds its own partition, directly from the indices of the cubes.
+ */
 class CubeGenerator : public seissol::geometry::MeshReader {
   public:
   CubeGenerator(int rank,
                 int nProcs,
-                const std::string& meshFile,
                 const seissol::initializer::parameters::CubeGeneratorParameters& cubeParams);
 
-  /*
-    inline void loadBar(int x, int n, int r = 100, int w = 50);
-    const char* dim2str(unsigned int dim);
-    template <typename A, typename B>
-    std::pair<B, A> flip_pair(const std::pair<A, B>& p);
-    void checkNcError(int error);
-  */
-  void cubeGenerator(unsigned int numCubes[4],
-                     unsigned int numPartitions[4],
-                     unsigned int boundaryMinx,
-                     unsigned int boundaryMaxx,
-                     unsigned int boundaryMiny,
-                     unsigned int boundaryMaxy,
-                     unsigned int boundaryMinz,
-                     unsigned int boundaryMaxz,
-                     unsigned int numCubesPerPart[4],
-                     unsigned long numElemPerPart[4],
-                     unsigned int numVrtxPerPart[4],
-                     unsigned int numBndElements[3],
-                     double scale,
-                     double scaleX,
-                     double scaleY,
-                     double scaleZ,
-                     double tx,
-                     double ty,
-                     double tz,
-                     const std::string& output);
+  private:
+  /**
+   * Finds all locals elements for each vertex
+   */
+  void findElementsPerVertex();
 };
 } // namespace seissol::geometry
 #endif // CUBEGENERATOR_H
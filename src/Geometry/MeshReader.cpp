@@ -16,7 +16,8 @@
 
 namespace seissol::geometry {
 
-MeshReader::MeshReader(int rank) : m_rank(rank), m_hasPlusFault(false) {}
+MeshReader::MeshReader(int rank)
+    : m_rank(rank), m_fileOrderElementIds(false), m_hasPlusFault(false) {}
 
 MeshReader::~MeshReader() {}
 
@@ -37,6 +38,12 @@ const std::unordered_map<int, std::vector<GhostElementMetadata>>
 
 const std::vector<Fault>& MeshReader::getFault() const { return m_fault; }
 
+const std::vector<unsigned long>& MeshReader::getGlobalElementIds() const {
+  return m_globalElementIds;
+}
+
+bool MeshReader::hasFileOrderElementIds() const { return m_fileOrderElementIds; }
+
 bool MeshReader::hasFault() const { return m_fault.size() > 0; }
 
 bool MeshReader::hasPlusFault() const { return m_hasPlusFault; }
@@ -223,6 +230,24 @@ void MeshReader::extractFaultInformation(
 }
 
 void MeshReader::exchangeGhostlayerMetadata() {
+  if (m_globalElementIds.size() != m_elements.size()) {
+    // the mesh format does not provide global ids; number the elements in rank order
+    unsigned long offset = 0;
+#ifdef USE_MPI
+    unsigned long numElements = m_elements.size();
+    MPI_Exscan(
+        &numElements, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+    if (m_rank == 0) {
+      offset = 0;
+    }
+#endif
+    m_globalElementIds.resize(m_elements.size());
+    for (std::size_t i = 0; i < m_elements.size(); ++i) {
+      m_globalElementIds[i] = offset + i;
+    }
+    m_fileOrderElementIds = false;
+  }
+
 #ifdef USE_MPI
   std::unordered_map<int, std::vector<GhostElementMetadata>> sendData;
   std::unordered_map<int, std::vector<GhostElementMetadata>> recvData;
@@ -237,11 +262,12 @@ void MeshReader::exchangeGhostlayerMetadata() {
   MPI_Datatype ghostElementType;
 
   // assume that all vertices are stored contiguously
-  const int datatypeCount = 2;
-  const std::vector<int> datatypeBlocklen{12, 1};
+  const int datatypeCount = 3;
+  const std::vector<int> datatypeBlocklen{12, 1, 1};
   const std::vector<MPI_Aint> datatypeDisplacement{offsetof(GhostElementMetadata, vertices),
-                                                   offsetof(GhostElementMetadata, group)};
-  const std::vector<MPI_Datatype> datatypeDatatype{MPI_DOUBLE, MPI_INT};
+                                                   offsetof(GhostElementMetadata, group),
+                                                   offsetof(GhostElementMetadata, globalId)};
+  const std::vector<MPI_Datatype> datatypeDatatype{MPI_DOUBLE, MPI_INT, MPI_UNSIGNED_LONG};
 
   MPI_Type_create_struct(datatypeCount,
                          datatypeBlocklen.data(),
@@ -270,6 +296,7 @@ void MeshReader::exchangeGhostlayerMetadata() {
         ghost.vertices[v][2] = vertex.coords[2];
       }
       ghost.group = element.group;
+      ghost.globalId = m_globalElementIds[elementIdx];
     }
 
     // TODO(David): evaluate, if MPI_Ssend (instead of just MPI_Send) makes sense here?
@@ -60,6 +60,7 @@ namespace seissol::geometry {
 struct GhostElementMetadata {
   double vertices[4][3];
   int group;
+  unsigned long globalId;
 };
 
 class MeshReader {
@@ -85,6 +86,12 @@ class MeshReader {
   /** Fault information */
   std::vector<Fault> m_fault;
 
+  /** Global (partition-independent) index of each local element */
+  std::vector<unsigned long> m_globalElementIds;
+
+  /** True if the global element ids are read from the mesh file (i.e. do not depend on the partitioning) */
+  bool m_fileOrderElementIds;
+
   /** Vertices of MPI Neighbors*/
   std::unordered_map<int, std::vector<GhostElementMetadata>> m_ghostlayerMetadata;
 
@@ -103,6 +110,15 @@ class MeshReader {
   const std::map<int, std::vector<MPINeighborElement>>& getMPIFaultNeighbors() const;
   const std::unordered_map<int, std::vector<GhostElementMetadata>> getGhostlayerMetadata() const;
   const std::vector<Fault>& getFault() const;
+  /**
+   * Global index of each local element. Partition-independent for meshes that provide it (PUML);
+   * otherwise, the elements are numbered consecutively in rank order.
+   */
+  const std::vector<unsigned long>& getGlobalElementIds() const;
+  /**
+   * True if the global element ids are given in file order, false if they are numbered in rank order.
+   */
+  bool hasFileOrderElementIds() const;
   bool hasFault() const;
   bool hasPlusFault() const;
 
@@ -332,8 +332,11 @@ void seissol::geometry::PUMLReader::getMesh(const PUML::TETPUML& puml) {
 
   // Compute everything local
   m_elements.resize(cells.size());
+  m_globalElementIds.resize(cells.size());
+  m_fileOrderElementIds = true;
   for (unsigned int i = 0; i < cells.size(); i++) {
     m_elements[i].localId = i;
+    m_globalElementIds[i] = cellIdsAsInFile[i];
 
     // Vertices
     PUML::Downward::vertices(
@@ -174,14 +174,14 @@ void seissol::initializer::initializeCellLocalMatrices( seissol::geometry::MeshR
         seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
         if (material[cell].local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
           seissol::model::getTransposedGodunovState(  seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)),
-                                                      seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].neighbor[side])),
+                                                      seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(material[cell].neighbor[side])),
                                                       cellInformation[cell].faceTypes[side],
                                                       QgodLocal,
                                                       QgodNeighbor );
           seissol::model::getTransposedCoefficientMatrix( seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)), 0, ATtilde );
         } else {
           seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                      material[cell].neighbor[side],     
+                                                      *material[cell].neighbor[side],
                                                       cellInformation[cell].faceTypes[side],
                                                       QgodLocal,
                                                       QgodNeighbor );
@@ -394,7 +394,8 @@ void seissol::initializer::initializeDynamicRuptureMatrices( seissol::geometry::
                                                               DynamicRupture*        dynRup,
                                                               unsigned*              ltsFaceToMeshFace,
                                                               GlobalData const&      global,
-                                                              TimeStepping const&/*    timeStepping*/ )
+                                                              TimeStepping const&/*    timeStepping*/,
+                                                              bool                   onlyMappings )
 {
   real TData[tensor::T::size()];
   real TinvData[tensor::Tinv::size()];
@@ -513,6 +514,10 @@ void seissol::initializer::initializeDynamicRuptureMatrices( seissol::geometry::
         }
       }
 
+      if (onlyMappings) {
+        continue;
+      }
+
       /// Transformation matrix
       auto T = init::T::view::create(TData);
       auto Tinv = init::Tinv::view::create(TinvData);
@@ -528,10 +533,10 @@ void seissol::initializer::initializeDynamicRuptureMatrices( seissol::geometry::
 
       if (plusLtsId != std::numeric_limits<unsigned>::max()) {
         plusMaterial = &material[plusLtsId].local;
-        minusMaterial = &material[plusLtsId].neighbor[ faceInformation[ltsFace].plusSide ];
+        minusMaterial = material[plusLtsId].neighbor[ faceInformation[ltsFace].plusSide ];
       } else {
         assert(minusLtsId != std::numeric_limits<unsigned>::max());
-        plusMaterial = &material[minusLtsId].neighbor[ faceInformation[ltsFace].minusSide ];
+        plusMaterial = material[minusLtsId].neighbor[ faceInformation[ltsFace].minusSide ];
         minusMaterial = &material[minusLtsId].local;
       }
 
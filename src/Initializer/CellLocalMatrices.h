@@ -67,6 +67,10 @@ namespace seissol {
                                      LTS* i_lts,
                                      Lut* i_ltsLut);
  
+     /**
+      * Sets up the DR face information and mappings and computes the DR face matrices.
+      * If onlyMappings is set, the face matrices are assumed to be present already (e.g. loaded from a cache).
+      **/
      void initializeDynamicRuptureMatrices( seissol::geometry::MeshReader const&      i_meshReader,                                                    
                                             LTSTree*               io_ltsTree,
                                             LTS*                   i_lts,
@@ -75,7 +79,8 @@ namespace seissol {
                                             DynamicRupture*        dynRup,
                                             unsigned*              ltsFaceToMeshFace,
                                             GlobalData const&      global,
-                                            TimeStepping const&    timeStepping );
+                                            TimeStepping const&    timeStepping,
+                                            bool                   onlyMappings = false );
 
       void copyCellMatricesToDevice(LTSTree*          ltsTree,
                                     LTS*              lts,
@@ -0,0 +1,277 @@
+#include "CellLocalMatricesCache.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utils/logger.h>
+
+#include "Common/filesystem.h"
+#include "Common/fnv1a.h"
+#include "Parallel/MPI.h"
+#include "version.h"
+
+namespace {
+
+constexpr std::array<char, 8> CacheMagic = {'S', 'S', 'C', 'L', 'M', 'C', '0', '1'};
+constexpr std::uint64_t SectionAlignment = 4096;
+
+struct FileHeader {
+  std::array<char, 8> magic;
+  std::uint64_t key;
+  std::uint64_t numberOfSections;
+};
+
+struct SectionHeader {
+  std::uint64_t offset;
+  std::uint64_t bytes;
+};
+
+struct Section {
+  void* data;
+  std::size_t bytes;
+};
+
+std::uint64_t hashBytes(std::uint64_t hash, const void* data, std::size_t size) {
+  return seissol::fnv1a(hash, data, size);
+}
+
+template <typename T>
+std::uint64_t hashValue(std::uint64_t hash, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be hashed.");
+  return hashBytes(hash, &value, sizeof(T));
+}
+
+template <typename MaterialT>
+std::uint64_t hashMaterial(std::uint64_t hash, const MaterialT& material) {
+  // skip the vtable pointer; the material classes consist of doubles only (i.e. no padding)
+  const auto* begin = reinterpret_cast<const char*>(&material.rho);
+  const auto* end = reinterpret_cast<const char*>(&material) + sizeof(MaterialT);
+  return hashBytes(hash, begin, end - begin);
+}
+
+template <typename T>
+Section makeSection(seissol::initializer::LTSTree* tree,
+                    const seissol::initializer::Variable<T>& handle) {
+  return Section{tree->var(handle), tree->getVariableSizes()[handle.index]};
+}
+
+std::vector<Section> collectSections(seissol::initializer::LTSTree* ltsTree,
+                                     seissol::initializer::LTS* lts,
+                                     seissol::initializer::LTSTree* dynRupTree,
+                                     seissol::initializer::DynamicRupture* dynRup) {
+  return {makeSection(ltsTree, lts->localIntegration),
+          makeSection(ltsTree, lts->neighboringIntegration),
+          makeSection(dynRupTree, dynRup->godunovData),
+          makeSection(dynRupTree, dynRup->fluxSolverPlus),
+          makeSection(dynRupTree, dynRup->fluxSolverMinus),
+          makeSection(dynRupTree, dynRup->waveSpeedsPlus),
+          makeSection(dynRupTree, dynRup->waveSpeedsMinus),
+          makeSection(dynRupTree, dynRup->impAndEta),
+          makeSection(dynRupTree, dynRup->impedanceMatrices)};
+}
+
+std::uint64_t alignOffset(std::uint64_t offset) {
+  return ((offset + SectionAlignment - 1) / SectionAlignment) * SectionAlignment;
+}
+
+} // namespace
+
+namespace seissol::initializer {
+
+CellLocalMatricesCache::CellLocalMatricesCache(const std::string& directory)
+    : m_directory(directory) {}
+
+std::string CellLocalMatricesCache::fileName() const {
+  return m_directory + "/cell-matrices-" + std::to_string(seissol::MPI::mpi.rank()) + ".bin";
+}
+
+void CellLocalMatricesCache::computeKey(const seissol::geometry::MeshReader& meshReader,
+                                        LTSTree* ltsTree,
+                                        LTS* lts,
+                                        Lut* ltsLut,
+                                        LTSTree* dynRupTree,
+                                        unsigned* ltsFaceToMeshFace,
+                                        const TimeStepping& timeStepping) {
+  const auto& elements = meshReader.getElements();
+  const auto& vertices = meshReader.getVertices();
+  const auto& fault = meshReader.getFault();
+
+  // build configuration and partition
+  std::uint64_t key = seissol::fnv1a(COMMIT_HASH);
+  key = hashValue(key, static_cast<int>(CONVERGENCE_ORDER));
+  key = hashValue(key, static_cast<int>(NUMBER_OF_QUANTITIES));
+  key = hashValue(key, sizeof(real));
+  key = hashValue(key, sizeof(LocalIntegrationData));
+  key = hashValue(key, sizeof(NeighboringIntegrationData));
+  key = hashValue(key, sizeof(CellMaterialData));
+  key = hashValue(key, seissol::MPI::mpi.rank());
+  key = hashValue(key, seissol::MPI::mpi.size());
+
+  // cell geometry, materials and LTS setup (hashed per cell in parallel, then combined)
+  const unsigned* ltsToMesh = ltsLut->getLtsToMeshLut(lts->material.mask);
+  std::vector<std::uint64_t> cellHashes;
+  for (auto it = ltsTree->beginLeaf(LayerMask(Ghost)); it != ltsTree->endLeaf(); ++it) {
+    const auto* material = it->var(lts->material);
+    const auto* cellInformation = it->var(lts->cellInformation);
+    const std::size_t layerOffset = cellHashes.size();
+    cellHashes.resize(layerOffset + it->getNumberOfCells());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+      const unsigned meshId = ltsToMesh[cell];
+      std::uint64_t hash = hashValue(seissol::fnv1a(""), meshId);
+      for (unsigned vertex = 0; vertex < 4; ++vertex) {
+        hash = hashValue(hash, vertices[elements[meshId].vertices[vertex]].coords);
+      }
+      hash = hashMaterial(hash, material[cell].local);
+      for (unsigned side = 0; side < 4; ++side) {
+        hash = hashMaterial(hash, *material[cell].neighbor[side]);
+      }
+      hash = hashValue(hash, cellInformation[cell].faceTypes);
+      hash = hashValue(hash, cellInformation[cell].clusterId);
+      hash =
+          hashValue(hash, timeStepping.globalCflTimeStepWidths[cellInformation[cell].clusterId]);
+      cellHashes[layerOffset + cell] = hash;
+    }
+    ltsToMesh += it->getNumberOfCells();
+  }
+  key = hashValue(key, cellHashes.size());
+  key = hashBytes(key, cellHashes.data(), cellHashes.size() * sizeof(std::uint64_t));
+
+  // dynamic rupture faces
+  const unsigned* layerLtsFaceToMeshFace = ltsFaceToMeshFace;
+  for (auto it = dynRupTree->beginLeaf(LayerMask(Ghost)); it != dynRupTree->endLeaf(); ++it) {
+    key = hashValue(key, it->getNumberOfCells());
+    for (unsigned ltsFace = 0; ltsFace < it->getNumberOfCells(); ++ltsFace) {
+      const auto& face = fault[layerLtsFaceToMeshFace[ltsFace]];
+      key = hashValue(key, layerLtsFaceToMeshFace[ltsFace]);
+      key = hashValue(key, face.element);
+      key = hashValue(key, face.side);
+      key = hashValue(key, face.neighborElement);
+      key = hashValue(key, face.neighborSide);
+      key = hashValue(key, face.normal);
+      key = hashValue(key, face.tangent1);
+      key = hashValue(key, face.tangent2);
+    }
+    layerLtsFaceToMeshFace += it->getNumberOfCells();
+  }
+
+  m_key = key;
+}
+
+bool CellLocalMatricesCache::load(LTSTree* ltsTree,
+                                  LTS* lts,
+                                  LTSTree* dynRupTree,
+                                  DynamicRupture* dynRup) {
+  const auto name = fileName();
+  const int fd = open(name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    logInfo(seissol::MPI::mpi.rank()) << "No cell-local matrices cache found at" << name;
+    return false;
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 ||
+      static_cast<std::size_t>(fileStat.st_size) < sizeof(FileHeader)) {
+    close(fd);
+    return false;
+  }
+  const std::size_t fileSize = fileStat.st_size;
+
+  void* mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    logWarning(seissol::MPI::mpi.rank())
+        << "Could not map the cell-local matrices cache" << name << ":" << strerror(errno);
+    return false;
+  }
+  const auto* base = static_cast<const char*>(mapped);
+
+  const auto sections = collectSections(ltsTree, lts, dynRupTree, dynRup);
+  const auto* header = reinterpret_cast<const FileHeader*>(base);
+  const auto* sectionHeaders = reinterpret_cast<const SectionHeader*>(base + sizeof(FileHeader));
+
+  bool valid = header->magic == CacheMagic && header->key == m_key &&
+               header->numberOfSections == sections.size() &&
+               sizeof(FileHeader) + sections.size() * sizeof(SectionHeader) <= fileSize;
+  for (std::size_t i = 0; valid && i < sections.size(); ++i) {
+    valid = sectionHeaders[i].bytes == sections[i].bytes &&
+            (sections[i].bytes == 0 ||
+             sectionHeaders[i].offset + sectionHeaders[i].bytes <= fileSize);
+  }
+
+  if (valid) {
+    for (std::size_t i = 0; i < sections.size(); ++i) {
+      if (sections[i].bytes > 0) {
+        std::memcpy(sections[i].data, base + sectionHeaders[i].offset, sections[i].bytes);
+      }
+    }
+    logInfo(seissol::MPI::mpi.rank()) << "Loaded cell-local matrices from cache" << name;
+  } else {
+    logInfo(seissol::MPI::mpi.rank()) << "Cell-local matrices cache" << name
+                                      << "is stale, recomputing.";
+  }
+
+  munmap(mapped, fileSize);
+  return valid;
+}
+
+void CellLocalMatricesCache::store(LTSTree* ltsTree,
+                                   LTS* lts,
+                                   LTSTree* dynRupTree,
+                                   DynamicRupture* dynRup) {
+  const auto sections = collectSections(ltsTree, lts, dynRupTree, dynRup);
+
+  FileHeader header;
+  header.magic = CacheMagic;
+  header.key = m_key;
+  header.numberOfSections = sections.size();
+
+  std::vector<SectionHeader> sectionHeaders(sections.size());
+  std::uint64_t offset = sizeof(FileHeader) + sections.size() * sizeof(SectionHeader);
+  for (std::size_t i = 0; i < sections.size(); ++i) {
+    offset = alignOffset(offset);
+    sectionHeaders[i].offset = offset;
+    sectionHeaders[i].bytes = sections[i].bytes;
+    offset += sections[i].bytes;
+  }
+
+  seissol::filesystem::create_directories(m_directory);
+
+  // write to a temporary file first, so that an interrupted run never leaves a corrupt cache
+  const auto name = fileName();
+  const auto tmpName = name + ".tmp";
+  std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+  file.write(reinterpret_cast<const char*>(sectionHeaders.data()),
+             sectionHeaders.size() * sizeof(SectionHeader));
+  for (std::size_t i = 0; i < sections.size(); ++i) {
+    file.seekp(sectionHeaders[i].offset);
+    if (sections[i].bytes > 0) {
+      file.write(static_cast<const char*>(sections[i].data), sections[i].bytes);
+    }
+  }
+  file.close();
+
+  if (!file) {
+    logWarning(seissol::MPI::mpi.rank()) << "Could not write the cell-local matrices cache" << name;
+    seissol::filesystem::remove(tmpName);
+    return;
+  }
+  seissol::filesystem::rename(tmpName, name);
+  logInfo(seissol::MPI::mpi.rank()) << "Stored cell-local matrices in cache" << name;
+}
+
+} // namespace seissol::initializer
@@ -0,0 +1,57 @@
+#ifndef INITIALIZER_CELLLOCALMATRICESCACHE_H_
+#define INITIALIZER_CELLLOCALMATRICESCACHE_H_
+
+#include <cstdint>
+#include <string>
+
+#include <Geometry/MeshReader.h>
+#include <Initializer/DynamicRupture.h>
+#include <Initializer/LTS.h>
+#include <Initializer/tree/LTSTree.hpp>
+#include <Initializer/tree/Lut.hpp>
+#include <Initializer/typedefs.hpp>
+
+namespace seissol::initializer {
+
+/**
+ * Per-rank on-disk cache for the cell-local and dynamic rupture matrices.
+ *
+ * The file consists of a fixed-size header followed by page-aligned sections, each holding the
+ * raw tree-wide array of one LTS variable. Hence, a cache hit is a plain mmap + memcpy.
+ * The cache is keyed by a hash over the local mesh geometry, the cell materials, the
+ * partition/LTS layout and the build configuration; any mismatch results in a recomputation.
+ *
+ * Enable it by setting SEISSOL_CELL_MATRICES_CACHE to a (shared) directory.
+ */
+class CellLocalMatricesCache {
+  public:
+  explicit CellLocalMatricesCache(const std::string& directory);
+
+  bool isEnabled() const { return !m_directory.empty(); }
+
+  void computeKey(const seissol::geometry::MeshReader& meshReader,
+                  LTSTree* ltsTree,
+                  LTS* lts,
+                  Lut* ltsLut,
+                  LTSTree* dynRupTree,
+                  unsigned* ltsFaceToMeshFace,
+                  const TimeStepping& timeStepping);
+
+  /**
+   * Fills the LocalIntegrationData/NeighboringIntegrationData and the DR face matrices from the
+   * cache file. Returns false (and leaves the tree untouched) if the file is missing or stale.
+   */
+  bool load(LTSTree* ltsTree, LTS* lts, LTSTree* dynRupTree, DynamicRupture* dynRup);
+
+  void store(LTSTree* ltsTree, LTS* lts, LTSTree* dynRupTree, DynamicRupture* dynRup);
+
+  private:
+  std::string fileName() const;
+
+  std::string m_directory;
+  std::uint64_t m_key{0};
+};
+
+} // namespace seissol::initializer
+
+#endif
@@ -226,6 +226,8 @@ struct seissol::initializer::LTSRateAndStateThermalPressurization : public seiss
   Variable<real[dr::misc::numPaddedPoints]> faultStrength;
   Variable<real[dr::misc::numPaddedPoints]>halfWidthShearZone;
   Variable<real[dr::misc::numPaddedPoints]> hydraulicDiffusivity;
+  // index of the (halfWidthShearZone, hydraulicDiffusivity) pair in the TP factor cache of the friction law
+  Variable<unsigned[dr::misc::numPaddedPoints]> tpParameterId;
 
   virtual void addTo(initializer::LTSTree& tree) {
     seissol::initializer::LTSRateAndStateFastVelocityWeakening::addTo(tree);
@@ -239,6 +241,7 @@ struct seissol::initializer::LTSRateAndStateThermalPressurization : public seiss
     tree.addVar(faultStrength, mask, ALIGNMENT, seissol::memory::Standard);
     tree.addVar(halfWidthShearZone, mask, ALIGNMENT, seissol::memory::Standard);
     tree.addVar(hydraulicDiffusivity, mask, ALIGNMENT, seissol::memory::Standard);
+    tree.addVar(tpParameterId, mask, ALIGNMENT, seissol::memory::Standard);
   }
 };
 
@@ -2,15 +2,75 @@
 #include "InitIO.hpp"
 #include "Initializer/BasicTypedefs.hpp"
 #include <SeisSol.h>
+#include <algorithm>
 #include <cstring>
 #include <vector>
 #include "DynamicRupture/Misc.h"
 #include "Common/filesystem.h"
+#include "Checkpoint/GlobalLayout.h"
 
 #include "Parallel/MPI.h"
 
 namespace {
 
+// Computes the global keys of all cells and fault faces, required for partition-independent
+// checkpoints
+static void setupCheckpointKeys(seissol::SeisSol& seissolInstance) {
+  auto& memoryManager = seissolInstance.getMemoryManager();
+  const auto& meshReader = seissolInstance.meshReader();
+
+  auto* lts = memoryManager.getLts();
+  auto* ltsTree = memoryManager.getLtsTree();
+  auto* ltsLut = memoryManager.getLtsLut();
+  auto* dynRup = memoryManager.getDynamicRupture();
+  auto* dynRupTree = memoryManager.getDynamicRuptureTree();
+
+  const auto& globalIds = meshReader.getGlobalElementIds();
+  const auto& elements = meshReader.getElements();
+  const auto& fault = meshReader.getFault();
+  const auto ghostMetadata = meshReader.getGhostlayerMetadata();
+
+  // Cells: the global element id; duplicated cells get the same key
+  const unsigned* ltsToMesh = ltsLut->getLtsToMeshLut(lts->dofs.mask);
+  std::vector<std::uint64_t> cellKeys(ltsTree->getNumberOfCells(lts->dofs.mask));
+  for (std::size_t ltsId = 0; ltsId < cellKeys.size(); ++ltsId) {
+    cellKeys[ltsId] = globalIds[ltsToMesh[ltsId]];
+  }
+
+  // Fault faces: the smaller global face id of both sides, such that the key does not depend on
+  // which side is local
+  auto faceKey = [&](int element, int side, int localNeighbor, int localNeighborSide) {
+    if (element >= 0) {
+      return 4 * static_cast<std::uint64_t>(globalIds[element]) + side;
+    }
+    // The element is located on another rank
+    const auto& neighbor = elements[localNeighbor];
+    const auto& ghost = ghostMetadata.at(neighbor.neighborRanks[localNeighborSide])
+                            .at(neighbor.mpiIndices[localNeighborSide]);
+    return 4 * static_cast<std::uint64_t>(ghost.globalId) +
+           neighbor.neighborSides[localNeighborSide];
+  };
+  const DRFaceInformation* faceInformation = dynRupTree->var(dynRup->faceInformation);
+  std::vector<std::uint64_t> faultKeys(fault.size());
+  for (std::size_t face = 0; face < faultKeys.size(); ++face) {
+    const auto& faultFace = fault[faceInformation[face].meshFace];
+    faultKeys[face] = std::min(
+        faceKey(faultFace.element,
+                faultFace.side,
+                faultFace.neighborElement,
+                faultFace.neighborSide),
+        faceKey(faultFace.neighborElement,
+                faultFace.neighborSide,
+                faultFace.element,
+                faultFace.side));
+  }
+
+  const auto keyOrder = meshReader.hasFileOrderElementIds() ? seissol::checkpoint::KeyOrder::File
+                                                            : seissol::checkpoint::KeyOrder::Rank;
+  seissolInstance.checkPointManager().setGlobalKeys(
+      std::move(cellKeys), tensor::Q::size(), std::move(faultKeys), keyOrder);
+}
+
 static void setupCheckpointing(seissol::SeisSol& seissolInstance) {
   const auto& seissolParams = seissolInstance.getSeisSolParameters();
   auto& memoryManager = seissolInstance.getMemoryManager();
@@ -46,6 +106,11 @@ static void setupCheckpointing(seissol::SeisSol& seissolInstance) {
   size_t numSides = seissolInstance.meshReader().getFault().size();
   unsigned int numBndGP = seissol::dr::misc::numberOfBoundaryGaussPoints;
 
+  if (seissolParams.output.checkpointParameters.enabled &&
+      seissol::checkpoint::GlobalLayout::isEnabled()) {
+    setupCheckpointKeys(seissolInstance);
+  }
+
   bool hasCheckpoint = seissolInstance.checkPointManager().init(
       reinterpret_cast<real*>(ltsTree->var(lts->dofs)),
       ltsTree->getNumberOfCells(lts->dofs.mask) * tensor::Q::size(),
@@ -11,11 +11,12 @@
 
 #ifdef USE_NETCDF
 #include "Geometry/NetcdfReader.h"
-#include "Geometry/CubeGenerator.h"
 #endif // USE_NETCDF
 #if defined(USE_HDF) && defined(USE_MPI)
 #include "Geometry/PUMLReader.h"
 #endif // defined(USE_HDF) && defined(USE_MPI)
+#include "Geometry/BinaryMeshReader.h"
+#include "Geometry/CubeGenerator.h"
 #include "Modules/Modules.h"
 #include "Monitoring/instrumentation.hpp"
 #include "Monitoring/Stopwatch.h"
@@ -54,7 +55,12 @@ static void postMeshread(seissol::geometry::MeshReader& meshReader,
   logInfo(seissol::MPI::mpi.rank()) << "Exchanging ghostlayer metadata.";
   meshReader.exchangeGhostlayerMetadata();
 
-  seissolInstance.getLtsLayout().setMesh(meshReader);
+  // query the material once; it is needed for the time step estimation and the cell setup
+  logInfo(seissol::MPI::mpi.rank()) << "Querying material parameters.";
+  seissolInstance.getMemoryManager().queryLocalMaterials(meshReader);
+
+  seissolInstance.getLtsLayout().setMesh(meshReader,
+                                         seissolInstance.getMemoryManager().getLocalMaterials());
 }
 
 static void readMeshPUML(const seissol::initializer::parameters::SeisSolParameters& seissolParams,
@@ -140,23 +146,13 @@ static size_t getNumOutgoingEdges(seissol::geometry::MeshReader& meshReader) {
 static void
     readCubeGenerator(const seissol::initializer::parameters::SeisSolParameters& seissolParams,
                       seissol::SeisSol& seissolInstance) {
-#if USE_NETCDF
   // unpack seissolParams
   const auto cubeParameters = seissolParams.cubeGenerator;
 
   const auto commRank = seissol::MPI::mpi.rank();
   const auto commSize = seissol::MPI::mpi.size();
-  std::string realMeshFileName = seissolParams.mesh.meshFileName + ".nc";
-  auto meshReader = new seissol::geometry::CubeGenerator(
-      commRank, commSize, realMeshFileName.c_str(), cubeParameters);
-
-  // Replace call to NetcdfReader with adapted Geometry/CubeGenerator
   seissolInstance.setMeshReader(
-      new seissol::geometry::NetcdfReader(commRank, commSize, realMeshFileName.c_str()));
-#else
-  logError() << "Tried using CubeGenerator to read a Netcdf mesh, however this build of SeisSol is "
-                "not linked to Netcdf.";
-#endif
+      new seissol::geometry::CubeGenerator(commRank, commSize, cubeParameters));
 }
 
 void seissol::initializer::initprocedure::initMesh(seissol::SeisSol& seissolInstance) {
@@ -199,11 +195,21 @@ void seissol::initializer::initprocedure::initMesh(seissol::SeisSol& seissolInst
   case seissol::initializer::parameters::MeshFormat::CubeGenerator:
     readCubeGenerator(seissolParams, seissolInstance);
     break;
+  case seissol::initializer::parameters::MeshFormat::Binary:
+    seissolInstance.setMeshReader(
+        new seissol::geometry::BinaryMeshReader(commRank, commSize, realMeshFileName.c_str()));
+    break;
   default:
     logError() << "Mesh reader not implemented for format" << static_cast<int>(meshFormat);
   }
 
   auto& meshReader = seissolInstance.meshReader();
+
+  if (!seissolParams.mesh.binaryMeshOutputFileName.empty()) {
+    // write the partitioned mesh before it gets modified by the post processing
+    seissol::geometry::writeBinaryMesh(meshReader, seissolParams.mesh.binaryMeshOutputFileName);
+  }
+
   postMeshread(
       meshReader, seissolParams.mesh.displacement, seissolParams.mesh.scaling, seissolInstance);
 
@@ -3,6 +3,7 @@
 #include "Initializer/ParameterDB.h"
 #include "Initializer/Parameters/SeisSolParameters.h"
 #include "Initializer/CellLocalMatrices.h"
+#include "Initializer/CellLocalMatricesCache.h"
 #include "Initializer/LTS.h"
 #include "Initializer/tree/LTSTree.hpp"
 #include "Initializer/time_stepping/common.hpp"
@@ -18,25 +19,93 @@
 
 #include "Parallel/MPI.h"
 
+#include <cassert>
 #include <cmath>
+#include <cstring>
 #include <type_traits>
 
+#include "utils/env.h"
+
 using namespace seissol::initializer;
 
 namespace {
 
 using Material_t = seissol::model::Material_t;
-using Plasticity = seissol::model::Plasticity;
-
-template <typename T>
-static std::vector<T> queryDB(seissol::initializer::QueryGenerator* queryGen,
-                              const std::string& fileName,
-                              size_t size) {
-  std::vector<T> vectorDB(size);
-  seissol::initializer::MaterialParameterDB<T> parameterDB;
-  parameterDB.setMaterialVector(&vectorDB);
-  parameterDB.evaluateModel(fileName, queryGen);
-  return vectorDB;
+
+/**
+ * Sends the (already evaluated and, if needed, attenuation-fitted) materials of the copy cells to
+ * the neighboring ranks. The materials of the ghost cells are returned in the order given by
+ * ghostIdxMap. Hence, the material on both sides of a partition boundary is bitwise identical,
+ * and no cell is evaluated more than once.
+ */
+std::vector<Material_t>
+    exchangeGhostMaterials(const seissol::geometry::MeshReader& meshReader,
+                           const std::vector<Material_t>& materials,
+                           const std::unordered_map<int, std::vector<unsigned>>& ghostIdxMap,
+                           std::size_t numberOfGhostCells) {
+  std::vector<Material_t> ghostMaterials(numberOfGhostCells);
+#ifdef USE_MPI
+  // skip the vtable pointer (it differs between processes); the material classes consist of
+  // doubles only
+  Material_t reference;
+  const auto payloadOffset = reinterpret_cast<const char*>(&reference.rho) -
+                             reinterpret_cast<const char*>(&reference);
+  const auto payloadSize = sizeof(Material_t) - payloadOffset;
+
+  constexpr int tag = 11;
+  const auto comm = seissol::MPI::mpi.comm();
+  const auto& mpiNeighbors = meshReader.getMPINeighbors();
+
+  std::unordered_map<int, std::vector<char>> sendData;
+  std::unordered_map<int, std::vector<char>> recvData;
+  std::vector<MPI_Request> requests(mpiNeighbors.size() * 2);
+
+  std::size_t counter = 0;
+  for (auto it = mpiNeighbors.begin(); it != mpiNeighbors.end(); ++it, counter += 2) {
+    const auto targetRank = it->first;
+    const auto count = it->second.elements.size();
+
+    recvData[targetRank].resize(count * payloadSize);
+
+    auto& send = sendData[targetRank];
+    send.resize(count * payloadSize);
+    for (std::size_t j = 0; j < count; ++j) {
+      const auto& material = materials[it->second.elements[j].localElement];
+      std::memcpy(send.data() + j * payloadSize,
+                  reinterpret_cast<const char*>(&material) + payloadOffset,
+                  payloadSize);
+    }
+
+    MPI_Irecv(recvData[targetRank].data(),
+              static_cast<int>(count * payloadSize),
+              MPI_BYTE,
+              targetRank,
+              tag,
+              comm,
+              &requests[counter]);
+    MPI_Isend(send.data(),
+              static_cast<int>(count * payloadSize),
+              MPI_BYTE,
+              targetRank,
+              tag,
+              comm,
+              &requests[counter + 1]);
+  }
+
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  for (const auto& [neighborRank, ghostIndices] : ghostIdxMap) {
+    const auto& recv = recvData.at(neighborRank);
+    for (std::size_t j = 0; j < ghostIndices.size(); ++j) {
+      std::memcpy(reinterpret_cast<char*>(&ghostMaterials[ghostIndices[j]]) + payloadOffset,
+                  recv.data() + j * payloadSize,
+                  payloadSize);
+    }
+  }
+#else
+  assert(numberOfGhostCells == 0);
+#endif
+  return ghostMaterials;
 }
 
 void initializeCellMaterial(seissol::SeisSol& seissolInstance) {
@@ -44,83 +113,45 @@ void initializeCellMaterial(seissol::SeisSol& seissolInstance) {
   const auto& meshReader = seissolInstance.meshReader();
   initializer::MemoryManager& memoryManager = seissolInstance.getMemoryManager();
 
-  // unpack ghost layer (merely a re-ordering operation, since the CellToVertexArray right now
-  // requires an vector there)
-  std::vector<std::array<std::array<double, 3>, 4>> ghostVertices;
-  std::vector<int> ghostGroups;
+  // index of each ghost cell (per neighboring rank and MPI index) in the ghost material vector
   std::unordered_map<int, std::vector<unsigned>> ghostIdxMap;
+  std::size_t numberOfGhostCells = 0;
   for (const auto& neighbor : meshReader.getGhostlayerMetadata()) {
     ghostIdxMap[neighbor.first].reserve(neighbor.second.size());
-    for (const auto& metadata : neighbor.second) {
-      ghostIdxMap[neighbor.first].push_back(ghostVertices.size());
-      std::array<std::array<double, 3>, 4> vertices;
-      for (size_t i = 0; i < 4; ++i) {
-        for (size_t j = 0; j < 3; ++j) {
-          vertices[i][j] = metadata.vertices[i][j];
-        }
-      }
-      ghostVertices.emplace_back(vertices);
-      ghostGroups.push_back(metadata.group);
+    for (std::size_t i = 0; i < neighbor.second.size(); ++i) {
+      ghostIdxMap[neighbor.first].push_back(numberOfGhostCells);
+      ++numberOfGhostCells;
     }
   }
 
-  // just a helper function for better readability
-  auto getBestQueryGenerator = [&](const seissol::initializer::CellToVertexArray& ctvArray) {
-    return seissol::initializer::getBestQueryGenerator(
-        seissol::initializer::parameters::isModelAnelastic(),
-        seissolParams.model.plasticity,
-        seissol::initializer::parameters::isModelAnisotropic(),
-        seissol::initializer::parameters::isModelPoroelastic(),
-        seissolParams.model.useCellHomogenizedMaterial,
-        ctvArray);
-  };
-
-  // material retrieval for copy+interior layers
-  seissol::initializer::QueryGenerator* queryGen =
-      getBestQueryGenerator(seissol::initializer::CellToVertexArray::fromMeshReader(meshReader));
-  auto materialsDB = queryDB<Material_t>(
-      queryGen, seissolParams.model.materialFileName, meshReader.getElements().size());
-
-  // plasticity (if needed)
-  std::vector<Plasticity> plasticityDB;
-  if (seissolParams.model.plasticity) {
-    // plasticity information is only needed on all interior+copy cells.
-    plasticityDB = queryDB<Plasticity>(
-        queryGen, seissolParams.model.materialFileName, meshReader.getElements().size());
-  }
-
-  // material retrieval for ghost layers
-  seissol::initializer::QueryGenerator* queryGenGhost = getBestQueryGenerator(
-      seissol::initializer::CellToVertexArray::fromVectors(ghostVertices, ghostGroups));
-  auto materialsDBGhost = queryDB<Material_t>(
-      queryGenGhost, seissolParams.model.materialFileName, ghostVertices.size());
+  // material and plasticity for copy+interior layers (queried together during the mesh setup)
+  auto materialsDB = std::move(memoryManager.getLocalMaterials());
+  auto plasticityDB = std::move(memoryManager.getLocalPlasticity());
+  assert(materialsDB.size() == meshReader.getElements().size());
+  assert(!seissolParams.model.plasticity || plasticityDB.size() == materialsDB.size());
 
 #if defined(USE_VISCOELASTIC) || defined(USE_VISCOELASTIC2)
   // we need to compute all model parameters before we can use them...
   // TODO(David): integrate this with the Viscoelastic material class or the ParameterDB directly?
   logDebug() << "Initializing attenuation.";
-#ifdef OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-  for (size_t i = 0; i < materialsDB.size(); ++i) {
-    auto& cellMat = materialsDB[i];
-    seissol::physics::fitAttenuation(
-        cellMat, seissolParams.model.freqCentral, seissolParams.model.freqRatio);
-  }
-#ifdef OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-  for (size_t i = 0; i < materialsDBGhost.size(); ++i) {
-    auto& cellMat = materialsDBGhost[i];
-    seissol::physics::fitAttenuation(
-        cellMat, seissolParams.model.freqCentral, seissolParams.model.freqRatio);
-  }
+  seissol::physics::fitAttenuation(
+      materialsDB, seissolParams.model.freqCentral, seissolParams.model.freqRatio);
 #endif
 
+  // material for the ghost layer, as evaluated by the neighboring ranks
+  auto materialsDBGhost =
+      exchangeGhostMaterials(meshReader, materialsDB, ghostIdxMap, numberOfGhostCells);
+
+  // the ghost materials are kept for the lifetime of the simulation, as the cells only reference
+  // them as neighbor materials
+  memoryManager.getGhostMaterials() = std::move(materialsDBGhost);
+  auto& ghostMaterials = memoryManager.getGhostMaterials();
+
   logDebug() << "Setting cell materials in the LTS tree (for interior and copy layers).";
   const auto& elements = meshReader.getElements();
-  unsigned* ltsToMesh =
-      memoryManager.getLtsLut()->getLtsToMeshLut(memoryManager.getLts()->material.mask);
+  auto* ltsLut = memoryManager.getLtsLut();
+  auto* materialTree = memoryManager.getLtsTree()->var(memoryManager.getLts()->material);
+  unsigned* ltsToMesh = ltsLut->getLtsToMeshLut(memoryManager.getLts()->material.mask);
 
   for (seissol::initializer::LTSTree::leaf_iterator it =
            memoryManager.getLtsTree()->beginLeaf(seissol::initializer::LayerMask(Ghost));
@@ -149,17 +180,18 @@ void initializeCellMaterial(seissol::SeisSol& seissolInstance) {
           if (element.neighborRanks[side] == seissol::MPI::mpi.rank()) {
             // material from interior or copy
             auto neighbor = element.neighbors[side];
-            initAssign(material.neighbor[side], materialsDB[neighbor]);
+            auto neighborLtsId = ltsLut->ltsId(memoryManager.getLts()->material.mask, neighbor);
+            material.neighbor[side] = &materialTree[neighborLtsId].local;
           } else {
             // material from ghost layer (computed locally)
             auto neighborRank = element.neighborRanks[side];
             auto neighborRankIdx = element.mpiIndices[side];
             auto materialGhostIdx = ghostIdxMap.at(neighborRank)[neighborRankIdx];
-            initAssign(material.neighbor[side], materialsDBGhost[materialGhostIdx]);
+            material.neighbor[side] = &ghostMaterials[materialGhostIdx];
           }
         } else {
           // otherwise, use the material from the own cell
-          initAssign(material.neighbor[side], localMaterial);
+          material.neighbor[side] = &material.local;
         }
       }
 
@@ -210,11 +242,31 @@ static void initializeCellMatrices(LtsInfo& ltsInfo, seissol::SeisSol& seissolIn
   auto& meshReader = seissolInstance.meshReader();
   auto& memoryManager = seissolInstance.getMemoryManager();
 
-  seissol::initializer::initializeCellLocalMatrices(meshReader,
-                                                    memoryManager.getLtsTree(),
-                                                    memoryManager.getLts(),
-                                                    memoryManager.getLtsLut(),
-                                                    ltsInfo.timeStepping);
+  // optional on-disk cache of the cell-local and DR face matrices (e.g. for restarts)
+  seissol::initializer::CellLocalMatricesCache matricesCache(
+      utils::Env::get<const char*>("SEISSOL_CELL_MATRICES_CACHE", ""));
+  bool matricesFromCache = false;
+  if (matricesCache.isEnabled()) {
+    matricesCache.computeKey(meshReader,
+                             memoryManager.getLtsTree(),
+                             memoryManager.getLts(),
+                             memoryManager.getLtsLut(),
+                             memoryManager.getDynamicRuptureTree(),
+                             ltsInfo.ltsMeshToFace,
+                             ltsInfo.timeStepping);
+    matricesFromCache = matricesCache.load(memoryManager.getLtsTree(),
+                                           memoryManager.getLts(),
+                                           memoryManager.getDynamicRuptureTree(),
+                                           memoryManager.getDynamicRupture());
+  }
+
+  if (!matricesFromCache) {
+    seissol::initializer::initializeCellLocalMatrices(meshReader,
+                                                      memoryManager.getLtsTree(),
+                                                      memoryManager.getLts(),
+                                                      memoryManager.getLtsLut(),
+                                                      ltsInfo.timeStepping);
+  }
 
   seissol::initializer::initializeDynamicRuptureMatrices(meshReader,
                                                          memoryManager.getLtsTree(),
@@ -224,7 +276,15 @@ static void initializeCellMatrices(LtsInfo& ltsInfo, seissol::SeisSol& seissolIn
                                                          memoryManager.getDynamicRupture(),
                                                          ltsInfo.ltsMeshToFace,
                                                          *memoryManager.getGlobalDataOnHost(),
-                                                         ltsInfo.timeStepping);
+                                                         ltsInfo.timeStepping,
+                                                         matricesFromCache);
+
+  if (matricesCache.isEnabled() && !matricesFromCache) {
+    matricesCache.store(memoryManager.getLtsTree(),
+                        memoryManager.getLts(),
+                        memoryManager.getDynamicRuptureTree(),
+                        memoryManager.getDynamicRupture());
+  }
 
   memoryManager.initFrictionData();
 
@@ -312,8 +372,12 @@ static void initializeClusteredLts(LtsInfo& ltsInfo, seissol::SeisSol& seissolIn
       ltsTree->var(lts->cellInformation), ltsToMesh, numberOfMeshCells);
 
   // TODO(David): move all of this method to the MemoryManager
+  seissol::Stopwatch lutWatch;
+  lutWatch.start();
   seissolInstance.getMemoryManager().getLtsLutUnsafe().createLuts(
       ltsTree, ltsToMesh, numberOfMeshCells);
+  lutWatch.pause();
+  lutWatch.printTime("LTS lookup tables created in:");
 
   delete[] ltsToMesh;
 
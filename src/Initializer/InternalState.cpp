@@ -42,8 +42,11 @@
 #include <limits>
 #include <cstddef>
 #include <cassert>
+#include <vector>
 #include <yateto.h>
 
+#include "Parallel/PrefixSum.h"
+
 void seissol::initializer::InternalState::deriveLayerLayout(       unsigned int                  i_numberOfClusters,
                                                                     unsigned int                 *i_numberOfRegions,
                                                                     unsigned int                **i_numberOfRegionCells,
@@ -124,41 +127,53 @@ void seissol::initializer::InternalState::setUpLayerPointers(       unsigned int
   // offset in the layer to the current region
   unsigned int l_offset = 0;
 
+  // position of the buffers/derivatives of each cell in memory (exclusive prefix sums over the region)
+  std::vector<unsigned int> l_bufferCounter;
+  std::vector<unsigned int> l_derivativeCounter;
+
   // iterate over all regions
   for( unsigned int l_region = 0; l_region < i_numberOfRegions; l_region++ ) {
-    // first cell belonging to the next region, if present
-    unsigned int l_firstNonRegionCell = l_firstRegionCell +
-                                        i_numberOfRegionCells[l_region];
+    const unsigned int l_numberOfCells = i_numberOfRegionCells[l_region];
+    const struct CellLocalInformation* l_regionInformation = i_cellLocalInformation + l_firstRegionCell;
+
+    l_bufferCounter.resize( l_numberOfCells + 1 );
+    l_derivativeCounter.resize( l_numberOfCells + 1 );
+    seissol::parallel::exclusivePrefixSum( l_numberOfCells,
+                                           [&](std::size_t l_cell) { return (l_regionInformation[l_cell].ltsSetup >> 8 ) % 2; },
+                                           l_bufferCounter.data() );
+    seissol::parallel::exclusivePrefixSum( l_numberOfCells,
+                                           [&](std::size_t l_cell) { return (l_regionInformation[l_cell].ltsSetup >> 9 ) % 2; },
+                                           l_derivativeCounter.data() );
+
+    // check that we have all buffers and derivatives
+    assert( l_bufferCounter[l_numberOfCells]     == i_numberOfBuffers[l_region] );
+    assert( l_derivativeCounter[l_numberOfCells] == i_numberOfDerivatives[l_region] );
 
-    // counters to dertermine the current position in memory of the buffers/derivatives
-    unsigned int l_bufferCounter = 0;
-    unsigned int l_derivativeCounter = 0;
+    real** l_regionBuffers = o_buffers + l_firstRegionCell;
+    real** l_regionDerivatives = o_derivatives + l_firstRegionCell;
 
     // iterate over this particular region
-    for( unsigned int l_cell = l_firstRegionCell; l_cell < l_firstNonRegionCell; l_cell++ ) {
-      // set pointers and increase conunters
-      if( (i_cellLocalInformation[l_cell].ltsSetup >> 8 ) % 2 ) {
-        o_buffers[l_cell] = i_layerMemory + l_offset
-                                          + l_bufferCounter * tensor::I::size();
-        l_bufferCounter++;
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for( unsigned int l_cell = 0; l_cell < l_numberOfCells; l_cell++ ) {
+      // set pointers
+      if( (l_regionInformation[l_cell].ltsSetup >> 8 ) % 2 ) {
+        l_regionBuffers[l_cell] = i_layerMemory + l_offset
+                                                + l_bufferCounter[l_cell] * tensor::I::size();
       }
-      else o_buffers[l_cell] = NULL;
+      else l_regionBuffers[l_cell] = NULL;
 
-      if( (i_cellLocalInformation[l_cell].ltsSetup >> 9 ) % 2 ) {
-        o_derivatives[l_cell] = i_layerMemory + l_offset 
-                                              + i_numberOfBuffers[l_region] * tensor::I::size()
-                                              + l_derivativeCounter * yateto::computeFamilySize<tensor::dQ>();
-        l_derivativeCounter++;
+      if( (l_regionInformation[l_cell].ltsSetup >> 9 ) % 2 ) {
+        l_regionDerivatives[l_cell] = i_layerMemory + l_offset
+                                                    + i_numberOfBuffers[l_region] * tensor::I::size()
+                                                    + l_derivativeCounter[l_cell] * yateto::computeFamilySize<tensor::dQ>();
       }
-      else o_derivatives[l_cell] = NULL;
+      else l_regionDerivatives[l_cell] = NULL;
     }
 
-    // check that we have all buffers and derivatives
-    assert( l_bufferCounter     == i_numberOfBuffers[l_region] );
-    assert( l_derivativeCounter == i_numberOfDerivatives[l_region] );
-
     // update offsets
-    l_firstRegionCell = l_firstNonRegionCell;
+    l_firstRegionCell += l_numberOfCells;
     l_offset += i_numberOfBuffers[l_region]     * tensor::I::size() +
                 i_numberOfDerivatives[l_region] * yateto::computeFamilySize<tensor::dQ>();
   }
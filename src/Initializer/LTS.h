@@ -56,7 +56,11 @@
 #else
 #   define MEMKIND_TIMEDOFS seissol::memory::Standard
 #endif
-#define MEMKIND_TIMEBUCKET MEMKIND_TIMEDOFS
+#ifdef USE_MEMKIND
+#   define MEMKIND_TIMEBUCKET MEMKIND_TIMEDOFS
+#else
+#   define MEMKIND_TIMEBUCKET seissol::memory::HugePages
+#endif
 #if CONVERGENCE_ORDER <= 4
 #   define MEMKIND_CONSTANT seissol::memory::HighBandwidth
 #else
@@ -71,12 +71,118 @@
 #include "MemoryAllocator.h"
 #include <Parallel/MPI.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <sys/mman.h>
+
+#include <utils/env.h>
 #include <utils/logger.h>
 
 #ifdef ACL_DEVICE
 #include "device.h"
 #endif
 
+namespace {
+  constexpr size_t HugePageSize = 2UL << 20;
+
+  enum class HugePageMode { None, Transparent, HugeTLB };
+
+  /**
+   * SEISSOL_HUGE_PAGES selects how the HugePages memkind is served:
+   * "none" (default): like Standard,
+   * "thp": 2 MiB aligned and madvise(MADV_HUGEPAGE),
+   * "hugetlb": explicit huge pages with mmap(MAP_HUGETLB), falls back to "thp" if none are left.
+   **/
+  HugePageMode hugePageMode() {
+    static const HugePageMode mode = [] {
+      const std::string value = utils::Env::get<const char*>("SEISSOL_HUGE_PAGES", "none");
+      if (value == "thp") {
+        return HugePageMode::Transparent;
+      }
+      if (value == "hugetlb") {
+        return HugePageMode::HugeTLB;
+      }
+      if (value != "none") {
+        logWarning(seissol::MPI::mpi.rank()) << "Unknown value for SEISSOL_HUGE_PAGES:" << value << "(using none)";
+      }
+      return HugePageMode::None;
+    }();
+    return mode;
+  }
+
+  struct HugePageAllocation {
+    size_t size;
+    bool hugeTLB;
+  };
+
+  std::mutex hugePageMutex;
+  //! all allocations with 2 MiB pages; the size is required by munmap
+  std::unordered_map<void*, HugePageAllocation> hugePageAllocations;
+  size_t hugePageBytesRequested = 0;
+
+  void* allocateHugePages(size_t i_size, size_t i_alignment) {
+    // small arrays do not benefit from huge pages
+    if (hugePageMode() == HugePageMode::None || i_size < HugePageSize) {
+      return seissol::memory::allocate(i_size, i_alignment, seissol::memory::Standard);
+    }
+
+    const size_t size = (i_size + HugePageSize - 1) / HugePageSize * HugePageSize;
+    void* l_ptrBuffer = nullptr;
+    bool hugeTLB = false;
+    if (hugePageMode() == HugePageMode::HugeTLB && i_alignment <= HugePageSize) {
+      l_ptrBuffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (l_ptrBuffer == MAP_FAILED) {
+        static bool warned = false;
+        if (!warned) {
+          logWarning() << "Could not allocate" << size << "bytes with MAP_HUGETLB (" << strerror(errno) << "), using transparent huge pages.";
+          warned = true;
+        }
+        l_ptrBuffer = nullptr;
+      } else {
+        hugeTLB = true;
+      }
+    }
+    if (l_ptrBuffer == nullptr) {
+      if (posix_memalign(&l_ptrBuffer, std::max(i_alignment, HugePageSize), size) != 0) {
+        logError() << "The malloc failed (bytes: " << size << ", alignment: " << HugePageSize << ", memkind: " << seissol::memory::HugePages << ").";
+      }
+#ifdef MADV_HUGEPAGE
+      if (madvise(l_ptrBuffer, size, MADV_HUGEPAGE) != 0) {
+        logWarning() << "madvise(MADV_HUGEPAGE) failed:" << strerror(errno);
+      }
+#endif
+    }
+
+    std::lock_guard<std::mutex> lock(hugePageMutex);
+    hugePageAllocations[l_ptrBuffer] = HugePageAllocation{size, hugeTLB};
+    hugePageBytesRequested += size;
+    return l_ptrBuffer;
+  }
+
+  void freeHugePages(void* i_pointer) {
+    std::lock_guard<std::mutex> lock(hugePageMutex);
+    const auto allocation = hugePageAllocations.find(i_pointer);
+    if (allocation == hugePageAllocations.end()) {
+      ::free(i_pointer);
+      return;
+    }
+    if (allocation->second.hugeTLB) {
+      munmap(i_pointer, allocation->second.size);
+    } else {
+      ::free(i_pointer);
+    }
+    hugePageBytesRequested -= allocation->second.size;
+    hugePageAllocations.erase(allocation);
+  }
+} // namespace
+
 void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind i_memkind)
 {
     void* l_ptrBuffer{nullptr};
@@ -89,6 +195,10 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
       return l_ptrBuffer;
     }
 
+    if (i_memkind == HugePages) {
+      return allocateHugePages(i_size, i_alignment);
+    }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if( i_memkind == 0 ) {
 #endif
@@ -136,6 +246,11 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
 }
 
 void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
+  if (i_memkind == HugePages) {
+    freeHugePages(i_pointer);
+    return;
+  }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (i_memkind == Standard) {
 #endif
@@ -162,6 +277,46 @@ void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
 #endif
 }
 
+void seissol::memory::reportHugePages() {
+  if (hugePageMode() == HugePageMode::None) {
+    return;
+  }
+
+  // The madvise'd regions have their own mappings (flag "hg"); hugetlb mappings are counted separately
+  unsigned long long bytes[3] = {hugePageBytesRequested, 0, 0};
+  std::ifstream smaps("/proc/self/smaps");
+  std::string line;
+  unsigned long long anonHugePages = 0;
+  while (std::getline(smaps, line)) {
+    std::istringstream fields(line);
+    std::string key;
+    fields >> key;
+    if (key == "AnonHugePages:") {
+      fields >> anonHugePages;
+    } else if (key == "Private_Hugetlb:" || key == "Shared_Hugetlb:") {
+      unsigned long long kiB = 0;
+      fields >> kiB;
+      bytes[2] += kiB * 1024;
+    } else if (key == "VmFlags:") {
+      std::string flag;
+      while (fields >> flag) {
+        if (flag == "hg") {
+          bytes[1] += anonHugePages * 1024;
+        }
+      }
+      anonHugePages = 0;
+    }
+  }
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, bytes, 3, MPI_UNSIGNED_LONG_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  constexpr double GiB = 1024.0 * 1024.0 * 1024.0;
+  logInfo(seissol::MPI::mpi.rank()) << "Huge pages: requested" << bytes[0] / GiB << "GiB, backed by"
+    << bytes[1] / GiB << "GiB transparent huge pages and" << bytes[2] / GiB << "GiB hugetlb pages.";
+}
+
 void seissol::memory::printMemoryAlignment( std::vector< std::vector<unsigned long long> > i_memoryAlignment ) {
   logDebug() << "printing memory alignment per struct";
   for( unsigned long long l_i = 0; l_i < i_memoryAlignment.size(); l_i++ ) {
@@ -88,11 +88,18 @@ namespace seissol {
       HighBandwidth = 1,
       DeviceGlobalMemory = 3,
       DeviceUnifiedMemory = 4,
-      PinnedMemory = 5
+      PinnedMemory = 5,
+      HugePages = 6
     };
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    /**
+     * Logs how much of the memory allocated with the HugePages memkind is actually backed by
+     * huge pages (summed over all ranks). Collective; call it after the memory has been touched.
+     **/
+    void reportHugePages();
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
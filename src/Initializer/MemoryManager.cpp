@@ -69,6 +69,10 @@
  **/
 #include "MemoryManager.h"
 
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <sstream>
 #include <unordered_set>
 #include <cmath>
 #include <type_traits>
@@ -84,8 +88,13 @@
 #include "InternalState.h"
 #include "Kernels/common.hpp"
 #include "Kernels/Touch.h"
+#include "Monitoring/Stopwatch.h"
+#include "Parallel/FirstTouch.h"
+#include "Parallel/MPI.h"
+#include "Parallel/PrefixSum.h"
 #include "SeisSol.h"
 #include "generated_code/tensor.h"
+#include "utils/env.h"
 
 #ifdef ACL_DEVICE
 #include "BatchRecorders/Recorders.h"
@@ -240,11 +249,18 @@ void seissol::initializer::MemoryManager::deriveLayerLayouts() {
 #endif // USE_MPI
 
     // iterate over all cells of this clusters interior
+    unsigned int l_numberOfInteriorBuffers = 0;
+    unsigned int l_numberOfInteriorDerivatives = 0;
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) reduction(+:l_numberOfInteriorBuffers,l_numberOfInteriorDerivatives)
+#endif
     for( unsigned int l_cell = 0; l_cell < m_meshStructure[tc].numberOfInteriorCells; l_cell++ ) {
       // check if this cell requires a buffer and/or derivatives
-      if( ( interiorCellInformation[l_cell].ltsSetup >> 8 ) % 2 == 1 ) m_numberOfInteriorBuffers[    tc]++;
-      if( ( interiorCellInformation[l_cell].ltsSetup >> 9 ) % 2 == 1 ) m_numberOfInteriorDerivatives[tc]++;
+      if( ( interiorCellInformation[l_cell].ltsSetup >> 8 ) % 2 == 1 ) l_numberOfInteriorBuffers++;
+      if( ( interiorCellInformation[l_cell].ltsSetup >> 9 ) % 2 == 1 ) l_numberOfInteriorDerivatives++;
     }
+    m_numberOfInteriorBuffers[    tc] = l_numberOfInteriorBuffers;
+    m_numberOfInteriorDerivatives[tc] = l_numberOfInteriorDerivatives;
   }
 }
 
@@ -336,7 +352,12 @@ void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    c
   real** derivatives = m_ltsTree.var(m_lts.derivatives);  // faceNeighborIds are ltsIds and not layer-local
   real *(*faceNeighbors)[4] = layer.var(m_lts.faceNeighbors);
   CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+  real** layerBuffers = layer.var(m_lts.buffers);
+  real** layerDerivatives = layer.var(m_lts.derivatives);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
   for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
     for (unsigned face = 0; face < 4; ++face) {
       if (cellInformation[cell].faceTypes[face] == FaceType::regular ||
@@ -358,10 +379,10 @@ void seissol::initializer::MemoryManager::initializeFaceNeighbors( unsigned    c
 	       cellInformation[cell].faceTypes[face] == FaceType::dirichlet ||
 	       cellInformation[cell].faceTypes[face] == FaceType::analytical) {
         if( (cellInformation[cell].ltsSetup >> face) % 2 == 0 ) { // free surface on buffers
-          faceNeighbors[cell][face] = layer.var(m_lts.buffers)[cell];
+          faceNeighbors[cell][face] = layerBuffers[cell];
         }
         else { // free surface on derivatives
-          faceNeighbors[cell][face] = layer.var(m_lts.derivatives)[cell];
+          faceNeighbors[cell][face] = layerDerivatives[cell];
         }
         assert(faceNeighbors[cell][face] != nullptr);
       }
@@ -553,8 +574,24 @@ void seissol::initializer::MemoryManager::deriveFaceDisplacementsBucket()
     real* (*displacements)[4] = layer->var(m_lts.faceDisplacements);
     CellMaterialData* cellMaterialData = layer->var(m_lts.material);
 
-    unsigned numberOfFaces = 0;
+    // index of the first displacement face of each cell
+    std::vector<unsigned> faceOffsets(layer->getNumberOfCells() + 1);
+    parallel::exclusivePrefixSum(layer->getNumberOfCells(), [&](std::size_t cell) {
+      unsigned numberOfCellFaces = 0;
+      for (unsigned int face = 0; face < 4; ++face) {
+        if (requiresDisplacement(cellInformation[cell], cellMaterialData[cell], face)) {
+          ++numberOfCellFaces;
+        }
+      }
+      return numberOfCellFaces;
+    }, faceOffsets.data());
+    const unsigned numberOfFaces = faceOffsets.back();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
     for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
+      unsigned faceIndex = faceOffsets[cell];
       for (unsigned int face = 0; face < 4; ++face) {
         if (requiresDisplacement(cellInformation[cell],
                                  cellMaterialData[cell],
@@ -564,8 +601,8 @@ void seissol::initializer::MemoryManager::deriveFaceDisplacementsBucket()
           // Thanks to this hack, the array contains a constant plus the offset of the current
           // cell.
           displacements[cell][face] =
-              static_cast<real*>(nullptr) + 1 + numberOfFaces * tensor::faceDisplacement::size();
-          ++numberOfFaces;
+              static_cast<real*>(nullptr) + 1 + faceIndex * tensor::faceDisplacement::size();
+          ++faceIndex;
         } else {
           displacements[cell][face] = nullptr;
         }
@@ -653,21 +690,41 @@ void seissol::initializer::MemoryManager::initializeFaceDisplacements()
     }
     real* (*displacements)[4] = layer->var(m_lts.faceDisplacements);
     real* bucket = static_cast<real*>(layer->bucket(m_lts.faceDisplacementsBuffer));
+    char* region = reinterpret_cast<char*>(bucket);
+    char* regionEnd = region + layer->getBucketSize(m_lts.faceDisplacementsBuffer);
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) shared(layer, displacements, bucket)
+#pragma omp parallel default(none) shared(layer, displacements, bucket, region, regionEnd)
 #endif // _OPENMP
-    for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
-      for (unsigned face = 0; face < 4; ++face) {
-        if (displacements[cell][face] != nullptr) {
-          // Remove constant part that was added in deriveDisplacementsBucket.
-          // We then have the pointer offset that needs to be added to the bucket.
-          // The final value of this pointer then points to a valid memory address
-          // somewhere in the bucket.
-          displacements[cell][face] = bucket + ((displacements[cell][face] - static_cast<real*>(nullptr)) - 1);
-          for (unsigned dof = 0; dof < tensor::faceDisplacement::size(); ++dof) {
-            // zero displacements
-            displacements[cell][face][dof] = static_cast<real>(0.0);
+    {
+      const auto range = parallel::staticScheduleRange(layer->getNumberOfCells());
+      for (unsigned cell = range.first; cell < range.second; ++cell) {
+        for (unsigned face = 0; face < 4; ++face) {
+          if (displacements[cell][face] != nullptr) {
+            // Remove constant part that was added in deriveDisplacementsBucket.
+            // We then have the pointer offset that needs to be added to the bucket.
+            // The final value of this pointer then points to a valid memory address
+            // somewhere in the bucket.
+            displacements[cell][face] = bucket + ((displacements[cell][face] - static_cast<real*>(nullptr)) - 1);
+            char* displacement = reinterpret_cast<char*>(displacements[cell][face]);
+            parallel::touchPages(displacement,
+                                 displacement + tensor::faceDisplacement::size() * sizeof(real),
+                                 region,
+                                 regionEnd);
+          }
+        }
+      }
+
+#ifdef _OPENMP
+#pragma omp barrier
+#endif // _OPENMP
+      for (unsigned cell = range.first; cell < range.second; ++cell) {
+        for (unsigned face = 0; face < 4; ++face) {
+          if (displacements[cell][face] != nullptr) {
+            for (unsigned dof = 0; dof < tensor::faceDisplacement::size(); ++dof) {
+              // zero displacements
+              displacements[cell][face][dof] = static_cast<real>(0.0);
+            }
           }
         }
       }
@@ -677,6 +734,16 @@ void seissol::initializer::MemoryManager::initializeFaceDisplacements()
 
 void seissol::initializer::MemoryManager::initializeMemoryLayout()
 {
+  // time spent in each phase (collective)
+  Stopwatch watch;
+  watch.start();
+  double lastSplit = 0;
+  auto printPhaseTime = [&](const char* text) {
+    const double split = watch.split();
+    Stopwatch::print(text, split - lastSplit);
+    lastSplit = split;
+  };
+
   // correct LTS-information in the ghost layer
   correctGhostRegionSetups();
 
@@ -707,11 +774,14 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
   }
 
   deriveFaceDisplacementsBucket();
+  printPhaseTime("Memory layout: bucket sizes derived in:");
 
   m_ltsTree.allocateBuckets();
+  printPhaseTime("Memory layout: buckets allocated in:");
 
   // initialize the internal state
   initializeBuffersDerivatives();
+  printPhaseTime("Memory layout: buffer and derivative pointers set in:");
 
   // initialize face neighbors
   for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
@@ -721,6 +791,7 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
 #endif
     initializeFaceNeighbors(tc, cluster.child<Interior>());
   }
+  printPhaseTime("Memory layout: face neighbors set in:");
 
 #ifdef ACL_DEVICE
   void* stream = device::DeviceInstance::getInstance().api->getDefaultStream();
@@ -738,9 +809,15 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
   for (auto it = m_ltsTree.beginLeaf(); it != m_ltsTree.endLeaf(); ++it) {
     real** buffers = it->var(m_lts.buffers);
     real** derivatives = it->var(m_lts.derivatives);
-    kernels::touchBuffersDerivatives(buffers, derivatives, it->getNumberOfCells());
+    const size_t bucketSize = it->getBucketSize(m_lts.buffersDerivatives);
+    kernels::touchBuffersDerivatives(buffers,
+                                     derivatives,
+                                     it->getNumberOfCells(),
+                                     bucketSize > 0 ? it->bucket(m_lts.buffersDerivatives) : nullptr,
+                                     bucketSize);
   }
 #endif
+  printPhaseTime("Memory layout: buffers and derivatives touched in:");
 
 #ifdef USE_MPI
   // initialize the communication structure
@@ -748,13 +825,65 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
 #endif
 
   initializeFaceDisplacements();
+  printPhaseTime("Memory layout: communication structure and face displacements set in:");
 
 #ifdef ACL_DEVICE
   seissol::initializer::MemoryManager::deriveRequiredScratchpadMemoryForWp(m_ltsTree, m_lts);
   m_ltsTree.allocateScratchPads();
+#else
+  seissol::memory::reportHugePages();
+
+  if (utils::Env::get<bool>("SEISSOL_NUMA_DIAGNOSTIC", false)) {
+    logNumaPlacement();
+  }
 #endif
 }
 
+void seissol::initializer::MemoryManager::logNumaPlacement() {
+  const int rank = seissol::MPI::mpi.rank();
+#ifdef USE_NUMA_AWARE_PINNING
+  auto logTree = [&](const char* treeName, LTSTree& tree) {
+    for (unsigned tc = 0; tc < tree.numChildren(); ++tc) {
+      auto logLayer = [&](const char* layerName, Layer& layer) {
+        std::map<int, size_t> pages;
+        auto add = [&](const void* memory, size_t bytes) {
+          for (const auto& [node, count] : parallel::pagesPerNumaNode(memory, bytes)) {
+            pages[node] += count;
+          }
+        };
+        for (unsigned var = 0; var < tree.getNumberOfVariables(); ++var) {
+          if (!layer.isMasked(tree.info(var).mask)) {
+            add(layer.var(var), tree.info(var).bytes * layer.getNumberOfCells());
+          }
+        }
+        for (unsigned bucket = 0; bucket < tree.getBucketSizes().size(); ++bucket) {
+          add(layer.bucket(bucket), layer.getBucketSize(bucket));
+        }
+
+        std::ostringstream placement;
+        for (const auto& [node, count] : pages) {
+          if (node >= 0) {
+            placement << " node " << node << ": " << count << ";";
+          } else if (node == -ENOENT) {
+            placement << " not touched: " << count << ";";
+          } else {
+            placement << " " << strerror(-node) << ": " << count << ";";
+          }
+        }
+        logInfo() << "NUMA placement on rank" << rank << "(" << treeName << ", cluster" << tc << ","
+                  << layerName << "):" << placement.str();
+      };
+      logLayer("copy", tree.child(tc).child<Copy>());
+      logLayer("interior", tree.child(tc).child<Interior>());
+    }
+  };
+  logTree("wave propagation", m_ltsTree);
+  logTree("dynamic rupture", m_dynRupTree);
+#else
+  logWarning(rank) << "SEISSOL_NUMA_DIAGNOSTIC requires SeisSol to be compiled with NUMA_AWARE_PINNING.";
+#endif // USE_NUMA_AWARE_PINNING
+}
+
 std::pair<MeshStructure *, CompoundGlobalData>
 seissol::initializer::MemoryManager::getMemoryLayout(unsigned int i_cluster) {
   MeshStructure *meshStructure = m_meshStructure + i_cluster;
@@ -776,6 +905,27 @@ void seissol::initializer::MemoryManager::initializeEasiBoundaryReader(const cha
   }
 }
 
+void seissol::initializer::MemoryManager::queryLocalMaterials(
+    const seissol::geometry::MeshReader& meshReader) {
+  const auto cellToVertex = CellToVertexArray::fromMeshReader(meshReader);
+  std::unique_ptr<QueryGenerator> queryGen(
+      getBestQueryGenerator(parameters::isModelAnelastic(),
+                            m_seissolParams->model.plasticity,
+                            parameters::isModelAnisotropic(),
+                            parameters::isModelPoroelastic(),
+                            m_seissolParams->model.useCellHomogenizedMaterial,
+                            cellToVertex));
+
+  m_localMaterials.resize(cellToVertex.size);
+  MaterialParameterDB<seissol::model::Material_t> parameterDB;
+  parameterDB.setMaterialVector(&m_localMaterials);
+  if (m_seissolParams->model.plasticity) {
+    m_localPlasticity.resize(cellToVertex.size);
+    parameterDB.setPlasticityVector(&m_localPlasticity);
+  }
+  parameterDB.evaluateModel(m_seissolParams->model.materialFileName, queryGen.get());
+}
+
 
 #ifdef ACL_DEVICE
 void seissol::initializer::MemoryManager::recordExecutionPaths(bool usePlasticity) {
@@ -805,7 +955,7 @@ bool seissol::initializer::isAcousticSideOfElasticAcousticInterface(CellMaterial
   return false;
 #else
   constexpr auto eps = std::numeric_limits<real>::epsilon();
-  return material.neighbor[face].mu > eps && material.local.mu < eps;
+  return material.neighbor[face]->mu > eps && material.local.mu < eps;
 #endif
 }
 bool seissol::initializer::isElasticSideOfElasticAcousticInterface(CellMaterialData &material,
@@ -814,7 +964,7 @@ bool seissol::initializer::isElasticSideOfElasticAcousticInterface(CellMaterialD
   return false;
 #else
   constexpr auto eps = std::numeric_limits<real>::epsilon();
-  return material.local.mu > eps && material.neighbor[face].mu < eps;
+  return material.local.mu > eps && material.neighbor[face]->mu < eps;
 #endif
 }
 
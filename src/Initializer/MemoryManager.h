@@ -181,6 +181,13 @@ class MemoryManager {
 
     EasiBoundary m_easiBoundary;
 
+    //! material and plasticity parameters of the local cells (indexed by mesh id)
+    std::vector<seissol::model::Material_t> m_localMaterials;
+    std::vector<seissol::model::Plasticity> m_localPlasticity;
+
+    //! materials of the ghost cells; referenced by CellMaterialData::neighbor
+    std::vector<seissol::model::Material_t> m_ghostMaterials;
+
     /**
      * Corrects the LTS Setups (buffer or derivatives, never both) in the ghost region
      **/
@@ -229,6 +236,11 @@ class MemoryManager {
     void initializeCommunicationStructure();
 #endif
 
+    /**
+     * Logs the number of pages per NUMA node of every layer (enabled with SEISSOL_NUMA_DIAGNOSTIC).
+     */
+    void logNumaPlacement();
+
   public:
     /**
      * Constructor
@@ -345,6 +357,25 @@ class MemoryManager {
 
     void initializeEasiBoundaryReader(const char* fileName);
 
+    /**
+     * Evaluates the material (and, if enabled, the plasticity) parameters of all local cells in a
+     * single easi query. The result is used for the time step estimation and the cell material
+     * initialization; it may be released afterwards.
+     **/
+    void queryLocalMaterials(const seissol::geometry::MeshReader& meshReader);
+
+    inline std::vector<seissol::model::Material_t>& getLocalMaterials() {
+      return m_localMaterials;
+    }
+
+    inline std::vector<seissol::model::Plasticity>& getLocalPlasticity() {
+      return m_localPlasticity;
+    }
+
+    inline std::vector<seissol::model::Material_t>& getGhostMaterials() {
+      return m_ghostMaterials;
+    }
+
     inline EasiBoundary* getEasiBoundaryReader() {
       return &m_easiBoundary;
     }
@@ -49,6 +49,7 @@
 #endif
 #include <cmath>
 #include <algorithm>
+#include <type_traits>
 #include "ParameterDB.h"
 
 #include "SeisSol.h"
@@ -261,16 +262,18 @@ namespace initializer {
 using namespace seissol::model;
 
 template <>
+template <class S>
 void MaterialParameterDB<ElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ElasticMaterial>& adapter) {
+    easi::ArrayOfStructsAdapter<S>& adapter) {
   adapter.addBindingPoint("rho", &ElasticMaterial::rho);
   adapter.addBindingPoint("mu", &ElasticMaterial::mu);
   adapter.addBindingPoint("lambda", &ElasticMaterial::lambda);
 }
 
 template <>
+template <class S>
 void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ViscoElasticMaterial>& adapter) {
+    easi::ArrayOfStructsAdapter<S>& adapter) {
   adapter.addBindingPoint("rho", &ViscoElasticMaterial::rho);
   adapter.addBindingPoint("mu", &ViscoElasticMaterial::mu);
   adapter.addBindingPoint("lambda", &ViscoElasticMaterial::lambda);
@@ -279,8 +282,9 @@ void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
 }
 
 template <>
+template <class S>
 void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<PoroElasticMaterial>& adapter) {
+    easi::ArrayOfStructsAdapter<S>& adapter) {
   adapter.addBindingPoint("bulk_solid", &PoroElasticMaterial::bulkSolid);
   adapter.addBindingPoint("rho", &PoroElasticMaterial::rho);
   adapter.addBindingPoint("lambda", &PoroElasticMaterial::lambda);
@@ -294,8 +298,9 @@ void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
 }
 
 template <>
+template <class S>
 void MaterialParameterDB<Plasticity>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<Plasticity>& adapter) {
+    easi::ArrayOfStructsAdapter<S>& adapter) {
   adapter.addBindingPoint("bulkFriction", &Plasticity::bulkFriction);
   adapter.addBindingPoint("plastCo", &Plasticity::plastCo);
   adapter.addBindingPoint("s_xx", &Plasticity::s_xx);
@@ -307,8 +312,9 @@ void MaterialParameterDB<Plasticity>::addBindingPoints(
 }
 
 template <>
+template <class S>
 void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<AnisotropicMaterial>& adapter) {
+    easi::ArrayOfStructsAdapter<S>& adapter) {
   adapter.addBindingPoint("rho", &AnisotropicMaterial::rho);
   adapter.addBindingPoint("c11", &AnisotropicMaterial::c11);
   adapter.addBindingPoint("c12", &AnisotropicMaterial::c12);
@@ -333,6 +339,15 @@ void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
   adapter.addBindingPoint("c66", &AnisotropicMaterial::c66);
 }
 
+namespace {
+/**
+ * Flat struct holding the material and the plasticity parameters of one query point, such that
+ * both can be evaluated in a single easi query.
+ */
+template <class T>
+struct MaterialWithPlasticity : public T, public Plasticity {};
+} // namespace
+
 template <class T>
 void MaterialParameterDB<T>::evaluateModel(std::string const& fileName,
                                            QueryGenerator const* const queryGen) {
@@ -341,9 +356,27 @@ void MaterialParameterDB<T>::evaluateModel(std::string const& fileName,
   const unsigned numPoints = query.numPoints();
 
   std::vector<T> materialsFromQuery(numPoints);
-  easi::ArrayOfStructsAdapter<T> adapter(materialsFromQuery.data());
-  MaterialParameterDB<T>().addBindingPoints(adapter);
-  model->evaluate(query, adapter);
+  std::vector<Plasticity> plasticityFromQuery;
+  if constexpr (!std::is_same_v<T, Plasticity>) {
+    if (m_plasticity != nullptr) {
+      std::vector<MaterialWithPlasticity<T>> combinedFromQuery(numPoints);
+      easi::ArrayOfStructsAdapter<MaterialWithPlasticity<T>> adapter(combinedFromQuery.data());
+      MaterialParameterDB<T>().addBindingPoints(adapter);
+      MaterialParameterDB<Plasticity>().addBindingPoints(adapter);
+      model->evaluate(query, adapter);
+
+      plasticityFromQuery.resize(numPoints);
+      for (unsigned i = 0; i < numPoints; ++i) {
+        materialsFromQuery[i] = static_cast<const T&>(combinedFromQuery[i]);
+        plasticityFromQuery[i] = static_cast<const Plasticity&>(combinedFromQuery[i]);
+      }
+    }
+  }
+  if (plasticityFromQuery.empty()) {
+    easi::ArrayOfStructsAdapter<T> adapter(materialsFromQuery.data());
+    MaterialParameterDB<T>().addBindingPoints(adapter);
+    model->evaluate(query, adapter);
+  }
 
   // Only use homogenization when ElementAverageGenerator has been supplied
   if (const ElementAverageGenerator* gen = dynamic_cast<const ElementAverageGenerator*>(queryGen)) {
@@ -356,12 +389,19 @@ void MaterialParameterDB<T>::evaluateModel(std::string const& fileName,
     for (unsigned elementIdx = 0; elementIdx < numElems; ++elementIdx) {
       m_materials->at(elementIdx) =
           this->computeAveragedMaterial(elementIdx, quadratureWeights, materialsFromQuery);
+      // the plasticity parameters are not averaged, but taken from the first sample
+      if (!plasticityFromQuery.empty()) {
+        m_plasticity->at(elementIdx) = plasticityFromQuery[NUM_QUADPOINTS * elementIdx];
+      }
     }
   } else {
     // Usual behavior without homogenization
     for (unsigned i = 0; i < numPoints; ++i) {
       m_materials->at(i) = T(materialsFromQuery[i]);
     }
+    if (!plasticityFromQuery.empty()) {
+      std::copy(plasticityFromQuery.begin(), plasticityFromQuery.end(), m_plasticity->begin());
+    }
   }
   delete model;
 }
@@ -505,6 +545,13 @@ void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(std::string const&
     model->evaluate(query, arrayOfStructsAdapter);
   }
   delete model;
+
+  // the anisotropic material may be given in two forms; hence, query the plasticity separately
+  if (m_plasticity != nullptr) {
+    MaterialParameterDB<Plasticity> plasticityDB;
+    plasticityDB.setMaterialVector(m_plasticity);
+    plasticityDB.evaluateModel(fileName, queryGen);
+  }
 }
 
 void FaultParameterDB::evaluateModel(std::string const& fileName,
@@ -186,10 +186,21 @@ class seissol::initializer::MaterialParameterDB : seissol::initializer::Paramete
                             std::vector<T> const& materialsFromQuery);
   void evaluateModel(std::string const& fileName, QueryGenerator const* const queryGen) override;
   void setMaterialVector(std::vector<T>* materials) { m_materials = materials; }
-  void addBindingPoints(easi::ArrayOfStructsAdapter<T>& adapter){};
+  /**
+   * If set, the plasticity parameters are evaluated in the same easi query as the material.
+   */
+  void setPlasticityVector(std::vector<seissol::model::Plasticity>* plasticity) {
+    m_plasticity = plasticity;
+  }
+  /**
+   * Binds the parameters of T; S may be any struct derived from T.
+   */
+  template <class S>
+  void addBindingPoints(easi::ArrayOfStructsAdapter<S>& adapter){};
 
   private:
-  std::vector<T>* m_materials;
+  std::vector<T>* m_materials{nullptr};
+  std::vector<seissol::model::Plasticity>* m_plasticity{nullptr};
 };
 
 class seissol::initializer::FaultParameterDB : seissol::initializer::ParameterDB {
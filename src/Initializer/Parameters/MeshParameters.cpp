@@ -10,11 +10,14 @@ MeshParameters readMeshParameters(ParameterReader* baseReader) {
                                                     "puml",
                                                     {{"netcdf", MeshFormat::Netcdf},
                                                      {"puml", MeshFormat::PUML},
-                                                     {"cubegenerator", MeshFormat::CubeGenerator}});
+                                                     {"cubegenerator", MeshFormat::CubeGenerator},
+                                                     {"binary", MeshFormat::Binary}});
   const std::string meshFileName =
       reader->readOrFail<std::string>("meshfile", "No mesh file given.");
   const std::string partitioningLib =
       reader->readWithDefault("partitioninglib", std::string("Default"));
+  const std::string binaryMeshOutputFileName =
+      reader->readWithDefault("binarymeshoutput", std::string(""));
 
   const auto displacementRaw = seissol::initializer::convertStringToArray<double, 3>(
       reader->readWithDefault("displacement", std::string("0.0 0.0 0.0")));
@@ -33,7 +36,12 @@ MeshParameters readMeshParameters(ParameterReader* baseReader) {
 
   reader->warnDeprecated({"periodic", "periodic_direction"});
 
-  return MeshParameters{
-      showEdgeCutStatistics, meshFormat, meshFileName, partitioningLib, displacement, scaling};
+  return MeshParameters{showEdgeCutStatistics,
+                        meshFormat,
+                        meshFileName,
+                        partitioningLib,
+                        binaryMeshOutputFileName,
+                        displacement,
+                        scaling};
 }
 } // namespace seissol::initializer::parameters
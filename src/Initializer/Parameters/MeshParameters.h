@@ -9,13 +9,14 @@
 
 namespace seissol::initializer::parameters {
 
-enum class MeshFormat : int { Netcdf, PUML, CubeGenerator };
+enum class MeshFormat : int { Netcdf, PUML, CubeGenerator, Binary };
 
 struct MeshParameters {
   bool showEdgeCutStatistics;
   MeshFormat meshFormat;
   std::string meshFileName;
   std::string partitioningLib;
+  std::string binaryMeshOutputFileName;
   Eigen::Vector3d displacement;
   Eigen::Matrix3d scaling;
 };
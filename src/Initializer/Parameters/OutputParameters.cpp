@@ -34,7 +34,8 @@ CheckpointParameters readCheckpointParameters(ParameterReader* baseReader) {
            {"hdf5", CheckpointingBackend::HDF5},
            {"mpio", CheckpointingBackend::MPIO},
            {"mpio_async", CheckpointingBackend::MPIO_ASYNC},
-           {"sionlib", CheckpointingBackend::SIONLIB}});
+           {"sionlib", CheckpointingBackend::SIONLIB},
+           {"compressed", CheckpointingBackend::COMPRESSED}});
     } else {
       reader->markUnused({"CheckpointingBackend"});
     }
@@ -14,7 +14,7 @@ namespace seissol::initializer::parameters {
 
 constexpr double veryLongTime = 1.0e100;
 
-enum CheckpointingBackend { POSIX, HDF5, MPIO, MPIO_ASYNC, SIONLIB, DISABLED };
+enum CheckpointingBackend { POSIX, HDF5, MPIO, MPIO_ASYNC, SIONLIB, COMPRESSED, DISABLED };
 
 enum class FaultRefinement { Triple = 1, Quad = 2, None = 3 };
 
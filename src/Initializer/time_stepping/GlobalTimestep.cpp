@@ -1,13 +1,27 @@
 #include "GlobalTimestep.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
 #include <functional>
+#include <iterator>
+#include <numeric>
+#include <regex>
+#include <set>
+#include <system_error>
 #include <Eigen/Dense>
 
+#include "Common/filesystem.h"
+#include "Common/fnv1a.h"
 #include "Equations/datastructures.hpp"
 #include "Initializer/ParameterDB.h"
 #include "Initializer/Parameters//SeisSolParameters.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+#include "version.h"
 
 #include "SeisSol.h"
 
@@ -36,14 +50,314 @@ static double
                    cfl * 2.0 * insphere / (pWaveVel * (2 * CONVERGENCE_ORDER - 1)));
 }
 
+static void reduceGlobalTimestep(GlobalTimestep& timestep) {
+  const auto minmaxCellPosition =
+      std::minmax_element(timestep.cellTimeStepWidths.begin(), timestep.cellTimeStepWidths.end());
+
+  double localMinTimestep = *minmaxCellPosition.first;
+  double localMaxTimestep = *minmaxCellPosition.second;
+
+#ifdef USE_MPI
+  MPI_Allreduce(&localMinTimestep,
+                &timestep.globalMinTimeStep,
+                1,
+                MPI_DOUBLE,
+                MPI_MIN,
+                seissol::MPI::mpi.comm());
+  MPI_Allreduce(&localMaxTimestep,
+                &timestep.globalMaxTimeStep,
+                1,
+                MPI_DOUBLE,
+                MPI_MAX,
+                seissol::MPI::mpi.comm());
+#else
+  timestep.globalMinTimeStep = localMinTimestep;
+  timestep.globalMaxTimeStep = localMaxTimestep;
+#endif
+}
+
+namespace {
+constexpr char TimestepCacheMagic[8] = {'S', 'S', 'C', 'F', 'L', 'D', 'T', '2'};
+
+struct TimestepCacheHeader {
+  char magic[8];
+  std::uint64_t key;
+  std::uint64_t numberOfCells;
+};
+
+/**
+ * Hashes the material model file and, recursively, the files it references. Included easi files
+ * are hashed by content; data files (e.g. ASAGI or NetCDF) by name, size and modification time.
+ * Relative paths are resolved against the directory of the including file and the working
+ * directory.
+ */
+void hashModelFile(std::uint64_t& hash,
+                   const std::string& fileName,
+                   std::set<std::string>& hashedFiles) {
+  if (!hashedFiles.insert(fileName).second) {
+    return;
+  }
+
+  std::ifstream modelFile(fileName, std::ios::binary);
+  const std::string model((std::istreambuf_iterator<char>(modelFile)),
+                          std::istreambuf_iterator<char>());
+  hash = seissol::fnv1a(hash, fileName.data(), fileName.size());
+  hash = seissol::fnv1a(hash, model.data(), model.size());
+
+  const auto resolve = [&](const std::string& name) {
+    const auto relative = seissol::filesystem::path(fileName).parent_path() / name;
+    std::error_code error;
+    if (seissol::filesystem::path(name).is_relative() &&
+        seissol::filesystem::exists(relative, error)) {
+      return relative.string();
+    }
+    return name;
+  };
+
+  static const std::regex includePattern(R"(!Include\s+([^\s#,\]\}]+))");
+  static const std::regex dataFilePattern(R"(\bfile\s*:\s*['"]?([^\s'"#,\]\}]+))");
+  for (auto it = std::sregex_iterator(model.begin(), model.end(), includePattern);
+       it != std::sregex_iterator();
+       ++it) {
+    hashModelFile(hash, resolve((*it)[1].str()), hashedFiles);
+  }
+  for (auto it = std::sregex_iterator(model.begin(), model.end(), dataFilePattern);
+       it != std::sregex_iterator();
+       ++it) {
+    const auto dataFile = resolve((*it)[1].str());
+    if (!hashedFiles.insert(dataFile).second) {
+      continue;
+    }
+    std::error_code error;
+    const std::uint64_t size = seissol::filesystem::file_size(dataFile, error);
+    const auto modified =
+        seissol::filesystem::last_write_time(dataFile, error).time_since_epoch().count();
+    hash = seissol::fnv1a(hash, dataFile.data(), dataFile.size());
+    hash = seissol::fnv1a(hash, &size, sizeof(size));
+    hash = seissol::fnv1a(hash, &modified, sizeof(modified));
+  }
+}
+
+/**
+ * Sidecar file holding the CFL time step widths of all cells, ordered by their global id, such
+ * that a rerun with the same mesh and material model skips the material query, independent of
+ * the number of ranks. Enabled by setting SEISSOL_TIMESTEP_CACHE to a directory.
+ *
+ * Loading and storing are collective: the cache is only used if it is valid on all ranks, as
+ * the material query itself is collective (e.g. for ASAGI).
+ */
+class TimestepCache {
+  public:
+  TimestepCache(double cfl,
+                double maximumAllowedTimeStep,
+                const std::string& velocityModel,
+                const seissol::initializer::CellToVertexArray& cellToVertex,
+                const std::vector<std::size_t>& globalCellIds,
+                const seissol::initializer::parameters::SeisSolParameters& seissolParams)
+      : directory(utils::Env::get<const char*>("SEISSOL_TIMESTEP_CACHE", "")),
+        globalCellIds(globalCellIds) {
+    if (directory.empty()) {
+      return;
+    }
+    assert(globalCellIds.size() == cellToVertex.size);
+    fileName = directory + "/cfl-timesteps.bin";
+
+    std::uint64_t hash = seissol::fnv1a(COMMIT_HASH);
+    const int order = CONVERGENCE_ORDER;
+    const bool homogenized = seissolParams.model.useCellHomogenizedMaterial;
+    hash = seissol::fnv1a(hash, &order, sizeof(order));
+    hash = seissol::fnv1a(hash, &homogenized, sizeof(homogenized));
+    hash = seissol::fnv1a(hash, &cfl, sizeof(cfl));
+    hash = seissol::fnv1a(hash, &maximumAllowedTimeStep, sizeof(maximumAllowedTimeStep));
+
+    // the material model, including all referenced files
+    hashModelFile(hash, velocityModel, modelFiles);
+
+    // cell geometry and groups; the cells are summed up such that the partition does not matter
+    std::uint64_t cellHash = 0;
+    for (unsigned cell = 0; cell < cellToVertex.size; ++cell) {
+      const std::uint64_t globalId = globalCellIds[cell];
+      const auto vertices = cellToVertex.elementCoordinates(cell);
+      const int group = cellToVertex.elementGroups(cell);
+      std::uint64_t localHash = seissol::fnv1a(hash, &globalId, sizeof(globalId));
+      for (const auto& vertex : vertices) {
+        localHash = seissol::fnv1a(localHash, vertex.data(), 3 * sizeof(double));
+      }
+      localHash = seissol::fnv1a(localHash, &group, sizeof(group));
+      cellHash += localHash;
+      numberOfCells = std::max(numberOfCells, globalId + 1);
+    }
+#ifdef USE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &cellHash, 1, MPI_UINT64_T, MPI_SUM, seissol::MPI::mpi.comm());
+    MPI_Allreduce(
+        MPI_IN_PLACE, &numberOfCells, 1, MPI_UINT64_T, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+    key = seissol::fnv1a(hash, &cellHash, sizeof(cellHash));
+    key = seissol::fnv1a(key, &numberOfCells, sizeof(numberOfCells));
+
+    // the local cells sorted by their global id, such that consecutive ids are read at once
+    sortedCells.resize(cellToVertex.size);
+    std::iota(sortedCells.begin(), sortedCells.end(), 0);
+    std::sort(sortedCells.begin(), sortedCells.end(), [&](std::size_t a, std::size_t b) {
+      return globalCellIds[a] < globalCellIds[b];
+    });
+  }
+
+  bool isEnabled() const { return !directory.empty(); }
+
+  /**
+   * Collective. Returns true if the time step widths of all cells on all ranks were loaded.
+   */
+  bool load(std::vector<double>& cellTimeStepWidths) const {
+    int loaded = loadLocal(cellTimeStepWidths);
+#ifdef USE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &loaded, 1, MPI_INT, MPI_LAND, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+    if (loaded) {
+      logInfo(seissol::MPI::mpi.rank())
+          << "Loaded the CFL time step widths from" << fileName << "(key" << key
+          << "for" << numberOfCells << "cells; material model files:" << modelFileList() << ")";
+    }
+    return loaded;
+  }
+
+  /**
+   * Collective.
+   */
+  void store(const std::vector<double>& cellTimeStepWidths) const {
+    const int rank = seissol::MPI::mpi.rank();
+    // write to a temporary file first, so that an interrupted run never leaves a corrupt file
+    const auto tmpName = fileName + ".tmp";
+
+    int written = 1;
+    if (rank == 0) {
+      TimestepCacheHeader header;
+      std::memcpy(header.magic, TimestepCacheMagic, sizeof(TimestepCacheMagic));
+      header.key = key;
+      header.numberOfCells = numberOfCells;
+
+      std::error_code error;
+      seissol::filesystem::create_directories(directory, error);
+      std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      written = static_cast<bool>(file);
+    }
+#ifdef USE_MPI
+    MPI_Bcast(&written, 1, MPI_INT, 0, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+    if (written) {
+      std::fstream file(tmpName, std::ios::binary | std::ios::in | std::ios::out);
+      std::vector<double> buffer;
+      forEachRun([&](std::size_t begin, std::size_t end) {
+        buffer.resize(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+          buffer[i - begin] = cellTimeStepWidths[sortedCells[i]];
+        }
+        file.seekp(offset(globalCellIds[sortedCells[begin]]));
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(double));
+      });
+      file.close();
+      written = static_cast<bool>(file);
+    }
+#ifdef USE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &written, 1, MPI_INT, MPI_LAND, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+    if (rank == 0) {
+      std::error_code error;
+      if (written) {
+        seissol::filesystem::rename(tmpName, fileName, error);
+      } else {
+        logWarning(rank) << "Could not write the time step cache" << fileName;
+        seissol::filesystem::remove(tmpName, error);
+      }
+    }
+  }
+
+  private:
+  static std::uint64_t offset(std::uint64_t globalId) {
+    return sizeof(TimestepCacheHeader) + globalId * sizeof(double);
+  }
+
+  /**
+   * Calls f(begin, end) for each range of sortedCells with consecutive global ids.
+   */
+  template <typename F>
+  void forEachRun(F&& f) const {
+    std::size_t begin = 0;
+    while (begin < sortedCells.size()) {
+      std::size_t end = begin + 1;
+      while (end < sortedCells.size() &&
+             globalCellIds[sortedCells[end]] == globalCellIds[sortedCells[end - 1]] + 1) {
+        ++end;
+      }
+      f(begin, end);
+      begin = end;
+    }
+  }
+
+  bool loadLocal(std::vector<double>& cellTimeStepWidths) const {
+    std::ifstream file(fileName, std::ios::binary);
+    TimestepCacheHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, TimestepCacheMagic, sizeof(TimestepCacheMagic)) != 0 ||
+        header.key != key || header.numberOfCells != numberOfCells) {
+      return false;
+    }
+
+    std::vector<double> buffer;
+    bool valid = true;
+    forEachRun([&](std::size_t begin, std::size_t end) {
+      buffer.resize(end - begin);
+      file.seekg(offset(globalCellIds[sortedCells[begin]]));
+      valid &= static_cast<bool>(
+          file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(double)));
+      for (std::size_t i = begin; i < end; ++i) {
+        cellTimeStepWidths[sortedCells[i]] = buffer[i - begin];
+      }
+    });
+    return valid;
+  }
+
+  std::string modelFileList() const {
+    std::string list;
+    for (const auto& modelFile : modelFiles) {
+      list += (list.empty() ? "" : ", ") + modelFile;
+    }
+    return list;
+  }
+
+  std::string directory;
+  std::string fileName;
+  const std::vector<std::size_t>& globalCellIds;
+  std::vector<std::size_t> sortedCells;
+  std::set<std::string> modelFiles;
+  std::uint64_t numberOfCells{0};
+  std::uint64_t key{0};
+};
+} // namespace
+
 GlobalTimestep
     computeTimesteps(double cfl,
                      double maximumAllowedTimeStep,
                      const std::string& velocityModel,
                      const seissol::initializer::CellToVertexArray& cellToVertex,
+                     const std::vector<std::size_t>& globalCellIds,
                      const seissol::initializer::parameters::SeisSolParameters& seissolParams) {
   using Material = seissol::model::Material_t;
 
+  TimestepCache cache(
+      cfl, maximumAllowedTimeStep, velocityModel, cellToVertex, globalCellIds, seissolParams);
+  if (cache.isEnabled()) {
+    GlobalTimestep timestep;
+    timestep.cellTimeStepWidths.resize(cellToVertex.size);
+    if (cache.load(timestep.cellTimeStepWidths)) {
+      reduceGlobalTimestep(timestep);
+      return timestep;
+    }
+  }
+
   auto* queryGen = seissol::initializer::getBestQueryGenerator(
       seissol::initializer::parameters::isModelAnelastic(),
       seissolParams.model.plasticity,
@@ -56,6 +370,22 @@ GlobalTimestep
   parameterDB.setMaterialVector(&materials);
   parameterDB.evaluateModel(velocityModel, queryGen);
 
+  auto timestep =
+      computeTimesteps(cfl, maximumAllowedTimeStep, materials, cellToVertex, seissolParams);
+  if (cache.isEnabled()) {
+    cache.store(timestep.cellTimeStepWidths);
+  }
+  return timestep;
+}
+
+GlobalTimestep
+    computeTimesteps(double cfl,
+                     double maximumAllowedTimeStep,
+                     const std::vector<seissol::model::Material_t>& materials,
+                     const seissol::initializer::CellToVertexArray& cellToVertex,
+                     const seissol::initializer::parameters::SeisSolParameters& seissolParams) {
+  assert(materials.size() == cellToVertex.size);
+
   GlobalTimestep timestep;
   timestep.cellTimeStepWidths.resize(cellToVertex.size);
 
@@ -66,29 +396,7 @@ GlobalTimestep
         computeCellTimestep(vertices, pWaveVel, cfl, maximumAllowedTimeStep, seissolParams);
   }
 
-  const auto minmaxCellPosition =
-      std::minmax_element(timestep.cellTimeStepWidths.begin(), timestep.cellTimeStepWidths.end());
-
-  double localMinTimestep = *minmaxCellPosition.first;
-  double localMaxTimestep = *minmaxCellPosition.second;
-
-#ifdef USE_MPI
-  MPI_Allreduce(&localMinTimestep,
-                &timestep.globalMinTimeStep,
-                1,
-                MPI_DOUBLE,
-                MPI_MIN,
-                seissol::MPI::mpi.comm());
-  MPI_Allreduce(&localMaxTimestep,
-                &timestep.globalMaxTimeStep,
-                1,
-                MPI_DOUBLE,
-                MPI_MAX,
-                seissol::MPI::mpi.comm());
-#else
-  timestep.globalMinTimeStep = localMinTimestep;
-  timestep.globalMaxTimeStep = localMaxTimestep;
-#endif
+  reduceGlobalTimestep(timestep);
   return timestep;
 }
 } // namespace seissol::initializer
@@ -16,11 +16,28 @@ namespace parameters {
 struct SeisSolParameters;
 }
 
+/**
+ * Queries the materials from the velocity model and computes the CFL time step widths.
+ *
+ * @param globalCellIds The global (partition-independent) id of each cell; used to key the time
+ *  step cache (see SEISSOL_TIMESTEP_CACHE)
+ */
 GlobalTimestep
     computeTimesteps(double cfl,
                      double maximumAllowedTimeStep,
                      const std::string& velocityModel,
                      const seissol::initializer::CellToVertexArray& cellToVertex,
+                     const std::vector<std::size_t>& globalCellIds,
+                     const seissol::initializer::parameters::SeisSolParameters& seissolParams);
+
+/**
+ * Same as above, but with the materials of all cells already queried.
+ */
+GlobalTimestep
+    computeTimesteps(double cfl,
+                     double maximumAllowedTimeStep,
+                     const std::vector<seissol::model::Material_t>& materials,
+                     const seissol::initializer::CellToVertexArray& cellToVertex,
                      const seissol::initializer::parameters::SeisSolParameters& seissolParams);
 } // namespace seissol::initializer
 
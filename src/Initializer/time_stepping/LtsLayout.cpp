@@ -47,6 +47,7 @@
 #include "LtsLayout.h"
 #include "MultiRate.hpp"
 #include "GlobalTimestep.hpp"
+#include <algorithm>
 #include <iterator>
 
 #include "Initializer/ParameterDB.h"
@@ -77,7 +78,8 @@ seissol::initializer::time_stepping::LtsLayout::~LtsLayout() {
   delete[] m_plainCopyRegions;
 }
 
-void seissol::initializer::time_stepping::LtsLayout::setMesh( const seissol::geometry::MeshReader &i_mesh ) {
+void seissol::initializer::time_stepping::LtsLayout::setMesh( const seissol::geometry::MeshReader &i_mesh,
+                                                             const std::vector<seissol::model::Material_t> &i_materials ) {
   // TODO: remove the copy by a pointer once the mesh stays constant
   m_cells = i_mesh.getElements();
   m_fault = i_mesh.getFault();
@@ -93,7 +95,7 @@ void seissol::initializer::time_stepping::LtsLayout::setMesh( const seissol::geo
   auto timesteps = seissol::initializer::computeTimesteps(
       seissolParams.timeStepping.cfl,
       seissolParams.timeStepping.maxTimestepWidth,
-      seissolParams.model.materialFileName,
+      i_materials,
       seissol::initializer::CellToVertexArray::fromMeshReader(i_mesh),
       seissolParams);
   
@@ -899,6 +901,27 @@ void seissol::initializer::time_stepping::LtsLayout::deriveClusteredCopyInterior
     }
   }
 
+  /*
+   * Sort the interior: cells with only regular or periodic faces come first, such that the neighboring
+   * integration can skip the face type checks for them. The partition is stable; hence, both parts keep the mesh order.
+   */
+  m_clusteredInteriorPositions.assign( m_cells.size(), std::numeric_limits<unsigned int>::max() );
+  for( unsigned int l_cluster = 0; l_cluster < m_localClusters.size(); l_cluster++ ) {
+    std::stable_partition( m_clusteredInterior[l_cluster].begin(),
+                           m_clusteredInterior[l_cluster].end(),
+                           [&]( unsigned int l_cell ) {
+                             for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+                               FaceType l_faceType = getFaceType( m_cells[l_cell].boundaries[l_face] );
+                               if( l_faceType != FaceType::regular && l_faceType != FaceType::periodic ) return false;
+                             }
+                             return true;
+                           } );
+
+    for( unsigned int l_interiorCell = 0; l_interiorCell < m_clusteredInterior[l_cluster].size(); l_interiorCell++ ) {
+      m_clusteredInteriorPositions[ m_clusteredInterior[l_cluster][l_interiorCell] ] = l_interiorCell;
+    }
+  }
+
   /*
    * Sort GTS regions: DR and "GTS on der" comes first.
    */
@@ -48,8 +48,10 @@
 #include <Geometry/MeshReader.h>
 
 #include <Initializer/Parameters/SeisSolParameters.h>
+#include <Equations/datastructures.hpp>
 
 #include <array>
+#include <vector>
 #include <limits>
 #include <cassert>
 
@@ -161,6 +163,12 @@ class seissol::initializer::time_stepping::LtsLayout {
      **/
     std::vector< std::vector< clusterCell > > m_clusteredInterior;
 
+    /**
+     * cluster local position of each interior cell in m_clusteredInterior
+     * [*] : mesh id
+     **/
+    std::vector< unsigned int > m_clusteredInteriorPositions;
+
     /**
      * copy region of a time stepping cluster.
      * first[0]: mpi rank of the neighboring cluster
@@ -448,14 +456,12 @@ class seissol::initializer::time_stepping::LtsLayout {
       o_localClusterId = m_cellClusterIds[ i_meshId ];
       o_localClusterId = getLocalClusterId( o_localClusterId );
 
-      std::vector< unsigned int >::iterator l_searchResult = std::lower_bound( m_clusteredInterior[o_localClusterId].begin(), // start of the search
-                                                                               m_clusteredInterior[o_localClusterId].end(),   // end of the search
-                                                                               i_meshId );                                    // value to search for
-      o_localCellId = l_searchResult - m_clusteredInterior[o_localClusterId].begin();
+      // the interior is not sorted by mesh ids (cf. deriveClusteredCopyInterior)
+      o_localCellId = m_clusteredInteriorPositions[ i_meshId ];
 
       // ensure a valid value
       if( o_localCellId > m_clusteredInterior[o_localClusterId].size() - 1 ||
-          *l_searchResult != i_meshId ) logError() << "no matching neighboring interior cell";
+          m_clusteredInterior[o_localClusterId][o_localCellId] != i_meshId ) logError() << "no matching neighboring interior cell";
     }
 
   public:
@@ -473,8 +479,10 @@ class seissol::initializer::time_stepping::LtsLayout {
      * Sets the mesh and mesh-dependent default values.
      *
      * @param i_mesh mesh.
+     * @param i_materials materials of all mesh cells (used to estimate the time step widths).
      **/
-    void setMesh( const seissol::geometry::MeshReader &i_mesh );
+    void setMesh( const seissol::geometry::MeshReader &i_mesh,
+                  const std::vector<seissol::model::Material_t> &i_materials );
 
     /**
      * Derives the layout of the LTS scheme.
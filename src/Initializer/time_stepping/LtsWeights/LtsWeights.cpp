@@ -406,7 +406,10 @@ int LtsWeights::ipow(int x, int y) {
 }
 
 seissol::initializer::GlobalTimestep LtsWeights::collectGlobalTimeStepDetails(double maximumAllowedTimeStep) {
-  return seissol::initializer::computeTimesteps(1.0, maximumAllowedTimeStep, m_velocityModel, seissol::initializer::CellToVertexArray::fromPUML(*m_mesh), seissolInstance.getSeisSolParameters());
+  // the cell ids as in the mesh file (see PUMLReader::read)
+  int const *cellIdsAsInFile = m_mesh->cellData(2);
+  std::vector<std::size_t> globalCellIds(cellIdsAsInFile, cellIdsAsInFile + m_mesh->cells().size());
+  return seissol::initializer::computeTimesteps(1.0, maximumAllowedTimeStep, m_velocityModel, seissol::initializer::CellToVertexArray::fromPUML(*m_mesh), globalCellIds, seissolInstance.getSeisSolParameters());
 }
 
 int LtsWeights::computeClusterIdsAndEnforceMaximumDifferenceCached(double curWiggleFactor) {
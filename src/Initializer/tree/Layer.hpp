@@ -44,6 +44,7 @@
 #include <Initializer/MemoryAllocator.h>
 #include <Initializer/BatchRecorders/DataTypes/ConditionalTable.hpp>
 #include "Initializer/DeviceGraph.h"
+#include "Parallel/FirstTouch.h"
 #include <bitset>
 #include <limits>
 #include <cstring>
@@ -130,6 +131,22 @@ public:
     return m_buckets[handle.index];
   }
 
+  /// untyped access by index, e.g. for diagnostics over all variables of a tree
+  void* var(unsigned index) {
+    assert(m_vars != NULL);
+    return m_vars[index];
+  }
+
+  void* bucket(unsigned index) {
+    assert(m_buckets != nullptr);
+    return m_buckets[index];
+  }
+
+  size_t getBucketSize(unsigned index) const {
+    assert(m_bucketSizes != nullptr);
+    return m_bucketSizes[index];
+  }
+
 #ifdef ACL_DEVICE
   void* getScratchpadMemory(ScratchpadMemory const& handle) {
     assert(handle.index != std::numeric_limits<unsigned>::max());
@@ -253,12 +270,7 @@ public:
       // NOTE: we don't touch device global memory because it is in a different address space
       // we will do deep-copy from the host to a device later on
       if (!isMasked(vars[var].mask) && (vars[var].memkind != seissol::memory::DeviceGlobalMemory)) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (unsigned cell = 0; cell < m_numberOfCells; ++cell) {
-          memset(static_cast<char*>(m_vars[var]) + cell * vars[var].bytes, 0, vars[var].bytes);
-        }
+        seissol::parallel::touchCellData(m_vars[var], vars[var].bytes, m_numberOfCells);
       }
     }
   }
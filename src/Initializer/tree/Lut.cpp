@@ -37,8 +37,11 @@
  * @section DESCRIPTION
  **/
 
+#include <algorithm>
 #include <array>
+#include <vector>
 #include "Lut.hpp"
+#include "Parallel/PrefixSum.h"
 
 seissol::initializer::Lut::LutsForMask::LutsForMask()
   : ltsToMesh(NULL), duplicatedMeshIds(NULL), numberOfDuplicatedMeshIds(0)
@@ -69,6 +72,9 @@ void seissol::initializer::Lut::LutsForMask::createLut(  LayerMask mask,
   unsigned offset = 0;
   for (LTSTree::leaf_iterator it = ltsTree->beginLeaf(); it != ltsTree->endLeaf(); ++it) {
     if (!it->isMasked(mask)) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
       for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
         unsigned meshId = globalLtsToMesh[globalLtsId + cell];
         ltsToMesh[offset + cell] = meshId;
@@ -81,37 +87,58 @@ void seissol::initializer::Lut::LutsForMask::createLut(  LayerMask mask,
   // meshToLts
   for (unsigned dup = 0; dup < MaxDuplicates; ++dup) {
     meshToLts[dup] = new unsigned[numberOfMeshIds];
-    std::fill(meshToLts[dup], meshToLts[dup] + numberOfMeshIds, std::numeric_limits<unsigned>::max());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (unsigned meshId = 0; meshId < numberOfMeshIds; ++meshId) {
+      meshToLts[dup][meshId] = std::numeric_limits<unsigned>::max();
+    }
   }
 
-  unsigned* numDuplicates = new unsigned[numberOfMeshIds];
-  memset(numDuplicates, 0, numberOfMeshIds * sizeof(unsigned));
+  std::vector<unsigned> numDuplicates(numberOfMeshIds, 0);
 
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned ltsId = 0; ltsId < numberOfLtsIds; ++ltsId) {
     unsigned meshId = ltsToMesh[ltsId];
     if (meshId != std::numeric_limits<unsigned int>::max()) {
-      assert( numDuplicates[meshId] < MaxDuplicates);
-      meshToLts[ numDuplicates[meshId]++ ][meshId] = ltsId;
-    }
-  }
-  
-  numberOfDuplicatedMeshIds = 0;
-  for (unsigned meshId = 0; meshId < numberOfMeshIds; ++meshId) {
-    if (numDuplicates[meshId] > 1) {
-      ++numberOfDuplicatedMeshIds;
+      unsigned dup;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+      dup = numDuplicates[meshId]++;
+      assert(dup < MaxDuplicates);
+      meshToLts[dup][meshId] = ltsId;
     }
   }
+
+  std::vector<unsigned> duplicateOffsets(numberOfMeshIds + 1);
+  seissol::parallel::exclusivePrefixSum(numberOfMeshIds, [&](std::size_t meshId) {
+    return numDuplicates[meshId] > 1 ? 1U : 0U;
+  }, duplicateOffsets.data());
+  numberOfDuplicatedMeshIds = duplicateOffsets.back();
   
   duplicatedMeshIds = new unsigned[numberOfDuplicatedMeshIds];
   
-  unsigned dupId = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
   for (unsigned meshId = 0; meshId < numberOfMeshIds; ++meshId) {
     if (numDuplicates[meshId] > 1) {
-      duplicatedMeshIds[dupId++] = meshId;
+      duplicatedMeshIds[duplicateOffsets[meshId]] = meshId;
+
+      // duplicates are inserted in arbitrary order above; restore the ascending order of the ltsIds
+      std::array<unsigned, MaxDuplicates> ltsIds;
+      for (unsigned dup = 0; dup < numDuplicates[meshId]; ++dup) {
+        ltsIds[dup] = meshToLts[dup][meshId];
+      }
+      std::sort(ltsIds.begin(), ltsIds.begin() + numDuplicates[meshId]);
+      for (unsigned dup = 0; dup < numDuplicates[meshId]; ++dup) {
+        meshToLts[dup][meshId] = ltsIds[dup];
+      }
     }
   }
-  
-  delete[] numDuplicates;
 }
 
 seissol::initializer::Lut::Lut()
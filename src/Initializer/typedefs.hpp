@@ -376,23 +376,11 @@ struct NeighboringIntegrationData {
 
 // material constants per cell
 struct CellMaterialData {
-  //TODO(Lukas/Sebastian):
-  //Get rid of ifdefs
-#if defined USE_ANISOTROPIC
-  seissol::model::AnisotropicMaterial local;
-  seissol::model::AnisotropicMaterial neighbor[4];
-#elif defined USE_VISCOELASTIC || defined USE_VISCOELASTIC2
-  seissol::model::ViscoElasticMaterial local;
-  seissol::model::ViscoElasticMaterial neighbor[4];
-#elif defined USE_ELASTIC
-  seissol::model::ElasticMaterial local;
-  seissol::model::ElasticMaterial neighbor[4];
-#elif defined USE_POROELASTIC
-  seissol::model::PoroElasticMaterial local;
-  seissol::model::PoroElasticMaterial neighbor[4];
-#else
-  static_assert(false, "No Compiler flag for the material behavior has been given. Current implementation allows: USE_ANISOTROPIC, USE_ELASTIC, USE_POROELASTIC, USE_VISCOELASTIC, USE_VISCOELASTIC2");
-#endif
+  seissol::model::Material_t local;
+  // Material behind each face. Only referenced, to avoid storing five copies of the (possibly large)
+  // material per cell: it points to the local material of the neighboring cell, to the ghost
+  // materials stored in the MemoryManager, or to the own local material at boundaries.
+  seissol::model::Material_t* neighbor[4];
 };
 
 struct DRFaceInformation {
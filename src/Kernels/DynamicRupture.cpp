@@ -53,6 +53,17 @@
 #endif
 #include <yateto.h>
 
+seissol::kernels::DynamicRupture::DynamicRupture() {
+#ifndef USE_DR_CELLAVERAGE
+  seissol::quadrature::GaussLegendre(m_unscaledTimePoints, m_unscaledTimeWeights, CONVERGENCE_ORDER);
+#ifdef USE_STP
+  for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
+    timeBasisFunctions[point] = std::make_shared<seissol::basisFunction::SampledTimeBasisFunctions<real>>(CONVERGENCE_ORDER, m_unscaledTimePoints[point]);
+  }
+#endif
+#endif
+}
+
 void seissol::kernels::DynamicRupture::checkGlobalData(GlobalData const* global, size_t alignment) {
 #ifndef NDEBUG
   for (unsigned face = 0; face < 4; ++face) {
@@ -104,15 +115,14 @@ void seissol::kernels::DynamicRupture::setTimeStepWidth(double timestep)
     timeWeights[timeInterval] = subIntervalWidth;
   }*/
 #else
-  // TODO(Lukas) Cache unscaled points/weights to avoid costly recomputation every timestep.
-  seissol::quadrature::GaussLegendre(timePoints, timeWeights, CONVERGENCE_ORDER);
+  // the cluster time step only changes for the last (partial) step before a synchronization point
+  if (timestep == m_timeStepWidth) {
+    return;
+  }
+  m_timeStepWidth = timestep;
   for (unsigned point = 0; point < CONVERGENCE_ORDER; ++point) {
-#ifdef USE_STP
-    double tau = timePoints[point];
-    timeBasisFunctions[point] = std::make_shared<seissol::basisFunction::SampledTimeBasisFunctions<real>>(CONVERGENCE_ORDER, tau);
-#endif
-    timePoints[point] = 0.5 * (timestep * timePoints[point] + timestep);
-    timeWeights[point] = 0.5 * timestep * timeWeights[point];
+    timePoints[point] = 0.5 * (timestep * m_unscaledTimePoints[point] + timestep);
+    timeWeights[point] = 0.5 * timestep * m_unscaledTimeWeights[point];
   }
 #endif
 }
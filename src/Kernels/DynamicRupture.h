@@ -67,6 +67,11 @@ class seissol::kernels::DynamicRupture {
     dynamicRupture::kernel::gpu_evaluateAndRotateQAtInterpolationPoints m_gpuKrnlPrototype;
     device::DeviceInstance& device = device::DeviceInstance::getInstance();
 #endif
+    //! Gauss-Legendre points and weights on [-1, 1]
+    double m_unscaledTimePoints[CONVERGENCE_ORDER];
+    double m_unscaledTimeWeights[CONVERGENCE_ORDER];
+    //! time step width which timePoints and timeWeights are scaled to
+    double m_timeStepWidth{-1.0};
 
   public:
     double timePoints[CONVERGENCE_ORDER];
@@ -76,12 +81,15 @@ class seissol::kernels::DynamicRupture {
     std::array<std::shared_ptr<basisFunction::SampledTimeBasisFunctions<real>>, CONVERGENCE_ORDER> timeBasisFunctions;
 #endif
 
-  DynamicRupture() {}
+  DynamicRupture();
 
     static void checkGlobalData(GlobalData const* global, size_t alignment);
     void setHostGlobalData(GlobalData const* global);
     void setGlobalData(const CompoundGlobalData& global);
     
+    /**
+     * Scales the time quadrature to [0, timestep]. Does nothing if the time step width did not change.
+     **/
     void setTimeStepWidth(double timestep);
 
     void spaceTimeInterpolation(DRFaceInformation const&    faceInfo,
@@ -91,6 +91,13 @@ class seissol::kernels::Neighbor : public NeighborBase {
                                   real* i_timeIntegrated[4],
                                   real* faceNeighbors_prefetch[4]);
 
+    /**
+     * Same as computeNeighborsIntegral for a cell whose faces are all regular or periodic.
+     **/
+    void computeRegularNeighborsIntegral(NeighborData& data,
+                                         real* i_timeIntegrated[4],
+                                         real* faceNeighbors_prefetch[4]);
+
     void computeBatchedNeighborsIntegral(ConditionalPointersToRealsTable &table);
 
     void flopsNeighborsIntegral(const FaceType i_faceTypes[4],
@@ -104,4 +111,16 @@ class seissol::kernels::Neighbor : public NeighborBase {
     unsigned bytesNeighborsIntegral();
 };
 
+#ifndef HAS_REGULAR_NEIGHBORS_INTEGRAL
+/**
+ * Fallback for equation sets whose Neighbor.cpp has no dedicated kernel for regular cells.
+ **/
+inline void seissol::kernels::Neighbor::computeRegularNeighborsIntegral(NeighborData& data,
+                                                                        real* i_timeIntegrated[4],
+                                                                        real* faceNeighbors_prefetch[4]) {
+  CellDRMapping const noDynamicRupture[4]{};
+  computeNeighborsIntegral(data, noDynamicRupture, i_timeIntegrated, faceNeighbors_prefetch);
+}
+#endif
+
 #endif
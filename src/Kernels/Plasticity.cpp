@@ -44,6 +44,7 @@
 #include <cstring>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include "common.hpp"
@@ -54,6 +55,87 @@
 using namespace device;
 #endif
 
+namespace {
+#ifndef MULTIPLE_SIMULATIONS
+  /**
+   * Constants for the elastic pre-screening.
+   * The nodal values are given by s_i = V_{i0} q_0 + sum_{l>0} V_{il} q_l + sigma0,
+   * where V_{i0} is the same for all nodes. Hence, for every stress component,
+   * |s_i - V_{00} q_0 - sigma0| <= max_i ||V_{i,l>0}||_2 ||q_{l>0}||_2.
+   */
+  struct ScreeningBounds {
+    double constantBasis;
+    double vandermondeRowNorm;
+    bool enabled;
+  };
+
+  ScreeningBounds computeScreeningBounds() {
+    auto v = seissol::init::v::view::create(const_cast<real*>(seissol::init::v::Values));
+    ScreeningBounds bounds{v(0, 0), 0.0, true};
+    for (unsigned i = 0; i < v.shape(0); ++i) {
+      bounds.enabled &=
+          std::abs(v(i, 0) - bounds.constantBasis) <= 1e-12 * std::abs(bounds.constantBasis);
+      double rowNorm = 0.0;
+      for (unsigned l = 1; l < v.shape(1); ++l) {
+        rowNorm += v(i, l) * v(i, l);
+      }
+      bounds.vandermondeRowNorm = std::max(bounds.vandermondeRowNorm, std::sqrt(rowNorm));
+    }
+    return bounds;
+  }
+
+  /** Returns true if no node of the cell can exceed the yield stress, using only the modal
+   *  coefficients, i.e. without converting to nodal values. The test is conservative.
+   */
+  bool isCertainlyElastic(PlasticityData const* plasticityData, real const* degreesOfFreedom) {
+    static const ScreeningBounds bounds = computeScreeningBounds();
+    if (!bounds.enabled) {
+      return false;
+    }
+
+    auto qStress = seissol::init::QStress::view::create(const_cast<real*>(degreesOfFreedom));
+    double average[6];
+    double deviation[6];
+    for (unsigned p = 0; p < 6; ++p) {
+      average[p] = bounds.constantBasis * qStress(0, p) + plasticityData->initialLoading[p];
+      double norm = 0.0;
+      for (unsigned l = 1; l < qStress.shape(0); ++l) {
+        norm += qStress(l, p) * qStress(l, p);
+      }
+      deviation[p] = bounds.vandermondeRowNorm * std::sqrt(norm);
+    }
+
+    // sqrt(I_2) is a semi-norm, thus tau_i <= tau(average) + tau(deviation)
+    const double meanStress = (average[0] + average[1] + average[2]) / 3.0;
+    const double meanDeviation = (deviation[0] + deviation[1] + deviation[2]) / 3.0;
+    double secondInvariant = 0.0;
+    double deviationInvariant = 0.0;
+    for (unsigned p = 0; p < 3; ++p) {
+      secondInvariant += 0.5 * (average[p] - meanStress) * (average[p] - meanStress);
+      deviationInvariant += 0.5 * deviation[p] * deviation[p];
+    }
+    for (unsigned p = 3; p < 6; ++p) {
+      secondInvariant += average[p] * average[p];
+      deviationInvariant += deviation[p] * deviation[p];
+    }
+    // Safety margin for the round-off of the nodal computation, which sums up all basis
+    // functions and then the stress components in working precision
+    const double margin =
+        (qStress.shape(0) + 6) * static_cast<double>(std::numeric_limits<real>::epsilon());
+    const double tauUpper =
+        (std::sqrt(secondInvariant) + std::sqrt(deviationInvariant)) * (1.0 + margin);
+    const double meanFriction = meanStress * plasticityData->sinAngularFriction;
+    const double taulimLower =
+        std::max(0.0,
+                 plasticityData->cohesionTimesCosAngularFriction - meanFriction -
+                     meanDeviation * std::abs(plasticityData->sinAngularFriction) -
+                     margin * (std::abs(plasticityData->cohesionTimesCosAngularFriction) +
+                               std::abs(meanFriction)));
+    return tauUpper <= taulimLower;
+  }
+#endif
+} // namespace
+
 namespace seissol::kernels {
   unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
                                          double timeStepWidth,
@@ -81,6 +163,13 @@ namespace seissol::kernels {
     static_assert(tensor::yieldFactor::size() <= tensor::meanStress::size(),
                   "Yield factor tensor must be smaller than mean stress tensor.");
 
+#ifndef MULTIPLE_SIMULATIONS
+    // Most cells are elastic most of the time; skip the nodal transform for these
+    if (isCertainlyElastic(plasticityData, degreesOfFreedom)) {
+      return 0;
+    }
+#endif
+
     //copy dofs for later comparison, only first dof of stresses required
     // @todo multiple sims
     
@@ -8,31 +8,88 @@
 #include <generated_code/init.h>
 #include <SourceTerm/PointSource.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace seissol::kernels {
 
 PointSourceClusterOnHost::PointSourceClusterOnHost(sourceterm::ClusterMapping mapping,
                                                    sourceterm::PointSources sources)
-    : clusterMapping_(std::move(mapping)), sources_(std::move(sources)) {}
+    : clusterMapping_(std::move(mapping)), sources_(std::move(sources)) {
+  if (sources_.mode == sourceterm::PointSources::NRF) {
+    computeMomentBasisNRF();
+    timeIntegrals_.resize(3 * sources_.numberOfSources);
+  } else {
+    timeIntegrals_.resize(sources_.numberOfSources);
+  }
+}
+
+void PointSourceClusterOnHost::computeMomentBasisNRF() {
+  // Moment tensor entries in SeisSol ordering (xx, yy, zz, xy, yz, xz), cf. momentToNRF
+  constexpr unsigned MomentIndices[6][2] = {{0, 0}, {1, 1}, {2, 2}, {0, 1}, {1, 2}, {0, 2}};
+
+  momentBasisNRF_.resize(sources_.numberOfSources);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (unsigned source = 0; source < sources_.numberOfSources; ++source) {
+    auto stiffnessTensor =
+        init::stiffnessTensor::view::create(sources_.stiffnessTensor[source].data());
+    const real* normal = sources_.tensor[source].data() + 6;
+    for (unsigned direction = 0; direction < 3; ++direction) {
+      // rotated slip for a unit slip in the given direction
+      const real* slip = sources_.tensor[source].data() + direction * 3;
+      auto& moment = momentBasisNRF_[source][direction];
+      std::fill(moment.data(), moment.data() + moment.size(), 0.0);
+      for (unsigned t = 0; t < 6; ++t) {
+        real value = 0.0;
+        for (unsigned i = 0; i < 3; ++i) {
+          for (unsigned j = 0; j < 3; ++j) {
+            value += stiffnessTensor(MomentIndices[t][0], MomentIndices[t][1], i, j) * slip[i] *
+                     normal[j];
+          }
+        }
+        moment[t] = -sources_.A[source] * value;
+      }
+    }
+  }
+}
+
+void PointSourceClusterOnHost::computeTimeIntegrals(double from, double to) {
+  const unsigned numberOfSamples = sources_.mode == sourceterm::PointSources::NRF ? 3 : 1;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (unsigned source = 0; source < sources_.numberOfSources; ++source) {
+    for (unsigned i = 0; i < numberOfSamples; ++i) {
+      auto o0 = sources_.sampleOffsets[i][source];
+      auto o1 = sources_.sampleOffsets[i][source + 1];
+      timeIntegrals_[source * numberOfSamples + i] =
+          computeSampleTimeIntegral(from,
+                                    to,
+                                    sources_.onsetTime[source],
+                                    sources_.samplingInterval[source],
+                                    sources_.sample[i].data() + o0,
+                                    o1 - o0);
+    }
+  }
+}
 
 void PointSourceClusterOnHost::addTimeIntegratedPointSources(double from, double to) {
   auto& mapping = clusterMapping_.cellToSources;
   if (mapping.size() > 0) {
+    // Evaluate all source time functions at once, then add the sources cell by cell.
+    // The sources are ordered by cells, hence no two threads update the same dofs.
+    computeTimeIntegrals(from, to);
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
     for (unsigned m = 0; m < mapping.size(); ++m) {
       unsigned startSource = mapping[m].pointSourcesOffset;
       unsigned endSource = mapping[m].pointSourcesOffset + mapping[m].numberOfPointSources;
-      if (sources_.mode == sourceterm::PointSources::NRF) {
-        for (unsigned source = startSource; source < endSource; ++source) {
-          addTimeIntegratedPointSourceNRF(source, from, to, *mapping[m].dofs);
-        }
-      } else {
-        for (unsigned source = startSource; source < endSource; ++source) {
-          addTimeIntegratedPointSourceFSRM(source, from, to, *mapping[m].dofs);
-        }
+      for (unsigned source = startSource; source < endSource; ++source) {
+        addPointSource(source, *mapping[m].dofs);
       }
     }
   }
@@ -40,64 +97,38 @@ void PointSourceClusterOnHost::addTimeIntegratedPointSources(double from, double
 
 unsigned PointSourceClusterOnHost::size() const { return sources_.numberOfSources; }
 
-void PointSourceClusterOnHost::addTimeIntegratedPointSourceNRF(unsigned source,
-                                                               double from,
-                                                               double to,
-                                                               real dofs[tensor::Q::size()]) {
-  real slip[] = {0.0, 0.0, 0.0};
-  for (unsigned i = 0; i < 3; ++i) {
-    auto o0 = sources_.sampleOffsets[i][source];
-    auto o1 = sources_.sampleOffsets[i][source + 1];
-    slip[i] = computeSampleTimeIntegral(from,
-                                        to,
-                                        sources_.onsetTime[source],
-                                        sources_.samplingInterval[source],
-                                        sources_.sample[i].data() + o0,
-                                        o1 - o0);
-  }
-
-  real rotatedSlip[] = {0.0, 0.0, 0.0};
-  for (unsigned i = 0; i < 3; ++i) {
-    for (unsigned j = 0; j < 3; ++j) {
-      rotatedSlip[j] += sources_.tensor[source][j + i * 3] * slip[i];
-    }
-  }
-
-  kernel::sourceNRF krnl;
-  krnl.Q = dofs;
-  krnl.mInvJInvPhisAtSources = sources_.mInvJInvPhisAtSources[source].data();
-  krnl.stiffnessTensor = sources_.stiffnessTensor[source].data();
-  krnl.mSlip = rotatedSlip;
-  krnl.mNormal = sources_.tensor[source].data() + 6;
-  krnl.mArea = -sources_.A[source];
-  krnl.momentToNRF = init::momentToNRF::Values;
-#ifdef MULTIPLE_SIMULATIONS
-  krnl.oneSimToMultSim = init::oneSimToMultSim::Values;
-#endif
-  krnl.execute();
-}
-
-void PointSourceClusterOnHost::addTimeIntegratedPointSourceFSRM(unsigned source,
-                                                                double from,
-                                                                double to,
-                                                                real dofs[tensor::Q::size()]) {
-  auto o0 = sources_.sampleOffsets[0][source];
-  auto o1 = sources_.sampleOffsets[0][source + 1];
-  auto slip = computeSampleTimeIntegral(from,
-                                        to,
-                                        sources_.onsetTime[source],
-                                        sources_.samplingInterval[source],
-                                        sources_.sample[0].data() + o0,
-                                        o1 - o0);
+void PointSourceClusterOnHost::addPointSource(unsigned source, real dofs[tensor::Q::size()]) {
   kernel::sourceFSRM krnl;
   krnl.Q = dofs;
   krnl.mInvJInvPhisAtSources = sources_.mInvJInvPhisAtSources[source].data();
-  krnl.momentFSRM = sources_.tensor[source].data();
-  krnl.stfIntegral = slip;
 #ifdef MULTIPLE_SIMULATIONS
   krnl.oneSimToMultSim = init::oneSimToMultSim::Values;
 #endif
-  krnl.execute();
+
+  if (sources_.mode == sourceterm::PointSources::NRF) {
+    const real* slip = &timeIntegrals_[3 * source];
+    // Sources which are not active in this time step do not contribute
+    if (slip[0] == 0.0 && slip[1] == 0.0 && slip[2] == 0.0) {
+      return;
+    }
+
+    // The NRF source is linear in the slip, thus it reduces to an FSRM source
+    sourceterm::AlignedArray<real, tensor::momentFSRM::size()> moment;
+    const auto& basis = momentBasisNRF_[source];
+    for (unsigned t = 0; t < moment.size(); ++t) {
+      moment[t] = basis[0][t] * slip[0] + basis[1][t] * slip[1] + basis[2][t] * slip[2];
+    }
+    krnl.momentFSRM = moment.data();
+    krnl.stfIntegral = 1.0;
+    krnl.execute();
+  } else {
+    if (timeIntegrals_[source] == 0.0) {
+      return;
+    }
+    krnl.momentFSRM = sources_.tensor[source].data();
+    krnl.stfIntegral = timeIntegrals_[source];
+    krnl.execute();
+  }
 }
 
 } // namespace seissol::kernels
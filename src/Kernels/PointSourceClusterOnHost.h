@@ -8,6 +8,9 @@
 
 #include <SourceTerm/typedefs.hpp>
 
+#include <array>
+#include <vector>
+
 namespace seissol::kernels {
 class PointSourceClusterOnHost : public PointSourceCluster {
   public:
@@ -16,17 +19,19 @@ class PointSourceClusterOnHost : public PointSourceCluster {
   unsigned size() const override;
 
   private:
-  void addTimeIntegratedPointSourceNRF(unsigned source,
-                                       double from,
-                                       double to,
-                                       real dofs[tensor::Q::size()]);
-  void addTimeIntegratedPointSourceFSRM(unsigned source,
-                                        double from,
-                                        double to,
-                                        real dofs[tensor::Q::size()]);
+  void computeMomentBasisNRF();
+  void computeTimeIntegrals(double from, double to);
+  void addPointSource(unsigned source, real dofs[tensor::Q::size()]);
 
   sourceterm::ClusterMapping clusterMapping_;
   sourceterm::PointSources sources_;
+
+  /** NRF: Moment tensor (in SeisSol ordering) per unit slip in the directions Tan1, Tan2, Normal,
+   * i.e. the moment tensor of a source is linear in the slip integrals. */
+  std::vector<std::array<sourceterm::AlignedArray<real, tensor::momentFSRM::size()>, 3>>
+      momentBasisNRF_;
+  //! Time integrals of the sources for the current time step (3 per source for NRF)
+  std::vector<real> timeIntegrals_;
 };
 } // namespace seissol::kernels
 
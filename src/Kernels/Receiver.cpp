@@ -122,17 +122,21 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
 #endif
       
 
+      real const* derivatives = receiver.derivatives;
+      if (derivatives == nullptr) {
 #ifdef USE_STP
-      m_timeKernel.executeSTP(timeStepWidth, tmpReceiverData, timeEvaluated, stp);
+        m_timeKernel.executeSTP(timeStepWidth, tmpReceiverData, timeEvaluated, stp);
 #else
-      m_timeKernel.computeAder( timeStepWidth,
-                                tmpReceiverData,
-                                tmp,
-                                timeEvaluated, // useless but the interface requires it
-                                timeDerivatives );
+        m_timeKernel.computeAder( timeStepWidth,
+                                  tmpReceiverData,
+                                  tmp,
+                                  timeEvaluated, // useless but the interface requires it
+                                  timeDerivatives );
+        derivatives = timeDerivatives;
 #endif
-      seissolInstance.flopCounter().incrementNonZeroFlopsOther(m_nonZeroFlops);
-      seissolInstance.flopCounter().incrementHardwareFlopsOther(m_hardwareFlops);
+        seissolInstance.flopCounter().incrementNonZeroFlopsOther(m_nonZeroFlops);
+        seissolInstance.flopCounter().incrementHardwareFlopsOther(m_hardwareFlops);
+      }
 
       receiverTime = time;
       while (receiverTime < expansionPoint + timeStepWidth) {
@@ -143,7 +147,7 @@ double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
         krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
         derivativeKrnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
 #else
-        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
+        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, derivatives, timeEvaluated);
 #endif
 
         krnl.execute();
@@ -51,6 +51,7 @@
 #include <Numerical_aux/Transformation.h>
 #include <Parallel/DataCollector.h>
 #include <generated_code/init.h>
+#include <utils/env.h>
 #include <optional>
 #include <vector>
 
@@ -79,6 +80,8 @@ namespace seissol {
       basisFunction::SampledBasisFunctions<real> basisFunctions;
       basisFunction::SampledBasisFunctionDerivatives<real> basisFunctionDerivatives;
       kernels::LocalData data;
+      //! Time derivatives stored by the local integration of the time cluster (nullptr: recomputed)
+      real const* derivatives{nullptr};
       std::vector<real> output;
     };
 
@@ -103,6 +106,9 @@ namespace seissol {
           seissolInstance(seissolInstance) {
         m_timeKernel.setHostGlobalData(global);
         m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+#if !defined(ACL_DEVICE) && !defined(USE_STP)
+        m_readsStoredDerivatives = utils::Env::get<bool>("SEISSOL_RECEIVER_STORED_DERIVATIVES", true);
+#endif
       }
 
       void addReceiver( unsigned          meshId,
@@ -125,6 +131,15 @@ namespace seissol {
         return m_receivers.end();
       }
 
+      /**
+       * True if the time cluster should store the time derivatives of all receiver cells
+       * (Receiver::derivatives), such that calcReceivers does not need to recompute them.
+       * In this case, calcReceivers has to be called after the local integration.
+       */
+      bool readsStoredDerivatives() const {
+        return m_readsStoredDerivatives;
+      }
+
       size_t ncols() const {
         size_t ncols = m_quantities.size();
         if (m_computeRotation) {
@@ -150,6 +165,7 @@ namespace seissol {
       double m_samplingInterval;
       double m_syncPointInterval;
       bool m_computeRotation;
+      bool m_readsStoredDerivatives{false};
       seissol::SeisSol& seissolInstance;
 
     };
@@ -7,31 +7,63 @@
 #include <generated_code/tensor.h>
 #include <yateto.h>
 
+#include "Parallel/FirstTouch.h"
+
 #ifdef ACL_DEVICE
 #include "device.h"
 #endif
 
 namespace seissol::kernels {
 
-void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned numberOfCells) {
+void touchBuffersDerivatives(real** buffers,
+                             real** derivatives,
+                             unsigned numberOfCells,
+                             void* bucket,
+                             std::size_t bucketSize) {
+  char* region = static_cast<char*>(bucket);
+  char* regionEnd = region + bucketSize;
+  constexpr std::size_t BufferSize = tensor::Q::size();
+  constexpr std::size_t DerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp parallel
 #endif
-  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
-    // touch buffers
-    real* buffer = buffers[cell];
-    if (buffer != NULL) {
-      for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
-        // zero time integration buffers
-        buffer[dof] = (real)0;
+  {
+    const auto range = parallel::staticScheduleRange(numberOfCells);
+
+    // place the pages with the distribution of the compute loops
+    for (unsigned cell = range.first; cell < range.second; ++cell) {
+      char* buffer = reinterpret_cast<char*>(buffers[cell]);
+      if (buffer != NULL) {
+        parallel::touchPages(buffer, buffer + BufferSize * sizeof(real), region, regionEnd);
+      }
+      char* derivative = reinterpret_cast<char*>(derivatives[cell]);
+      if (derivative != NULL) {
+        parallel::touchPages(
+            derivative, derivative + DerivativesSize * sizeof(real), region, regionEnd);
       }
     }
 
-    // touch derivatives
-    real* derivative = derivatives[cell];
-    if (derivative != NULL) {
-      for (unsigned dof = 0; dof < yateto::computeFamilySize<tensor::dQ>(); ++dof) {
-        derivative[dof] = (real)0;
+    // pages starting in the padding between the buffers and the derivatives are not zeroed yet
+#ifdef _OPENMP
+#pragma omp barrier
+#endif
+    for (unsigned cell = range.first; cell < range.second; ++cell) {
+      // touch buffers
+      real* buffer = buffers[cell];
+      if (buffer != NULL) {
+        for (unsigned dof = 0; dof < BufferSize; ++dof) {
+          // zero time integration buffers
+          buffer[dof] = (real)0;
+        }
+      }
+
+      // touch derivatives
+      real* derivative = derivatives[cell];
+      if (derivative != NULL) {
+        for (unsigned dof = 0; dof < DerivativesSize; ++dof) {
+          derivative[dof] = (real)0;
+        }
       }
     }
   }
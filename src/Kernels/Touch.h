@@ -6,9 +6,19 @@
 
 #include <Kernels/precision.hpp>
 
+#include <cstddef>
+
 namespace seissol::kernels {
 
-void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned numberOfCells);
+/**
+ * Zeroes the buffers and derivatives of a layer. The pages of the bucket are placed with the same
+ * static schedule as the compute loops (cf. Parallel/FirstTouch.h).
+ */
+void touchBuffersDerivatives(real** buffers,
+                             real** derivatives,
+                             unsigned numberOfCells,
+                             void* bucket,
+                             std::size_t bucketSize);
 void fillWithStuff(real* buffer, unsigned nValues, bool onDevice);
 
 } // namespace seissol::kernels
@@ -106,6 +106,16 @@ void LoopStatistics::addSample(
   }
 }
 
+void LoopStatistics::addWork(unsigned region,
+                             long long nonZeroFlops,
+                             long long hardwareFlops,
+                             double bytes) {
+  auto& vars = regions[region].variables;
+  vars.nonZeroFlops += nonZeroFlops;
+  vars.hardwareFlops += hardwareFlops;
+  vars.bytes += bytes;
+}
+
 void LoopStatistics::reset() {
   for (auto& region : regions) {
     region.times.resize(0);
@@ -116,7 +126,7 @@ void LoopStatistics::reset() {
 
 void LoopStatistics::printSummary(MPI_Comm comm) {
   const auto nRegions = regions.size();
-  constexpr int numberOfSumComponents = 6;
+  constexpr int numberOfSumComponents = 9;
   auto sums = std::vector<double>(numberOfSumComponents * nRegions);
   double totalTimePerRank = 0.0;
 
@@ -139,6 +149,15 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
   auto getNumberOfSamples = [&sums](std::size_t region) -> double& {
     return sums[numberOfSumComponents * region + 5];
   };
+  auto getNonZeroFlops = [&sums](std::size_t region) -> double& {
+    return sums[numberOfSumComponents * region + 6];
+  };
+  auto getHardwareFlops = [&sums](std::size_t region) -> double& {
+    return sums[numberOfSumComponents * region + 7];
+  };
+  auto getBytes = [&sums](std::size_t region) -> double& {
+    return sums[numberOfSumComponents * region + 8];
+  };
 
   for (unsigned region = 0; region < nRegions; ++region) {
     getNumIters(region) = regions[region].variables.x;
@@ -147,6 +166,9 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
     getTime(region) = regions[region].variables.y;
     getTimeSquared(region) = regions[region].variables.y2;
     getNumberOfSamples(region) = regions[region].variables.n;
+    getNonZeroFlops(region) = regions[region].variables.nonZeroFlops;
+    getHardwareFlops(region) = regions[region].variables.hardwareFlops;
+    getBytes(region) = regions[region].variables.bytes;
 
     // Make sure that events that lead to duplicate accounting are ignored
     if (regions[region].includeInSummary) {
@@ -229,6 +251,17 @@ void LoopStatistics::printSummary(MPI_Comm comm) {
                       << ", standard error:" << se << ")";
       }
       totalTime += y;
+
+      // The times are summed over all ranks, hence the rates are the mean rates of one rank
+      const double hardwareFlops = getHardwareFlops(region);
+      const double bytes = getBytes(region);
+      if (y > 0 && (hardwareFlops > 0 || bytes > 0)) {
+        const double intensity = bytes > 0 ? hardwareFlops / bytes : 0;
+        logInfo(rank) << regions[region].name << "(per rank):" << getNonZeroFlops(region) / y * 1.e-9
+                      << "GFLOP/s (non-zero)," << hardwareFlops / y * 1.e-9
+                      << "GFLOP/s (hardware)," << bytes / y * 1.e-9
+                      << "GB/s, arithmetic intensity:" << intensity << "FLOP/byte";
+      }
     }
 
     logInfo(rank) << "Total time spent in compute kernels:" << totalTime
@@ -66,6 +66,12 @@ class LoopStatistics {
   void addSample(
       unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end);
 
+  /**
+   * Adds the (estimated) work of one execution of a region. The summary reports the achieved
+   * GFLOP/s, GB/s and the arithmetic intensity for all regions with work.
+   */
+  void addWork(unsigned region, long long nonZeroFlops, long long hardwareFlops, double bytes);
+
   void reset();
 
   void printSummary(MPI_Comm comm);
@@ -87,6 +93,9 @@ class LoopStatistics {
     double y = 0;
     double y2 = 0;
     unsigned long long n = 0;
+    double nonZeroFlops = 0;
+    double hardwareFlops = 0;
+    double bytes = 0;
   };
 
   struct Region {
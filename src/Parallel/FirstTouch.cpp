@@ -0,0 +1,51 @@
+#include "FirstTouch.h"
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include "utils/logger.h"
+
+#ifndef __APPLE__
+#ifdef USE_NUMA_AWARE_PINNING
+#include <numaif.h>
+#endif // USE_NUMA_AWARE_PINNING
+#endif // __APPLE__
+
+namespace seissol::parallel {
+
+std::map<int, std::size_t> pagesPerNumaNode(const void* memory, std::size_t bytes) {
+  std::map<int, std::size_t> pages;
+#ifndef __APPLE__
+#ifdef USE_NUMA_AWARE_PINNING
+  if (memory == nullptr || bytes == 0) {
+    return pages;
+  }
+
+  const std::uintptr_t page = pageSize();
+  const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(memory) / page * page;
+  const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(memory) + bytes;
+
+  // move_pages only queries the node if no target nodes are given
+  constexpr std::size_t BatchSize = 4096;
+  std::vector<void*> addresses(BatchSize);
+  std::vector<int> status(BatchSize);
+  for (std::uintptr_t address = begin; address < end; address += BatchSize * page) {
+    const std::size_t count = std::min<std::size_t>(BatchSize, (end - address + page - 1) / page);
+    for (std::size_t i = 0; i < count; ++i) {
+      addresses[i] = reinterpret_cast<void*>(address + i * page);
+    }
+    if (move_pages(0, count, addresses.data(), nullptr, status.data(), 0) != 0) {
+      logWarning() << "Could not query the NUMA placement:" << strerror(errno);
+      return {};
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      ++pages[status[i]];
+    }
+  }
+#endif // USE_NUMA_AWARE_PINNING
+#endif // __APPLE__
+  return pages;
+}
+
+} // namespace seissol::parallel
@@ -0,0 +1,97 @@
+#ifndef PARALLEL_FIRSTTOUCH_H_
+#define PARALLEL_FIRSTTOUCH_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <utility>
+
+#include <unistd.h>
+
+namespace seissol::parallel {
+
+/**
+ * NUMA-aware first touch.
+ *
+ * Linux places a page on the NUMA node of the thread which writes to it first. The compute loops
+ * distribute the cells of a layer with "#pragma omp for schedule(static)". Hence, the memory of a
+ * layer is touched with exactly the same distribution, and every page is touched by the thread
+ * which owns the byte at the beginning of the page. This makes the placement deterministic, also
+ * for pages which are shared by two threads.
+ *
+ * This only helps if the OpenMP threads are pinned (e.g. OMP_PLACES=cores).
+ */
+
+inline std::size_t pageSize() {
+  static const std::size_t size = sysconf(_SC_PAGESIZE);
+  return size;
+}
+
+/**
+ * Returns the cells [first, last) which the calling thread gets in a loop over numberOfCells
+ * cells with schedule(static). Has to be called by all threads of a parallel region.
+ */
+inline std::pair<unsigned, unsigned> staticScheduleRange(unsigned numberOfCells) {
+  unsigned first = numberOfCells;
+  unsigned last = numberOfCells;
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif // _OPENMP
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    first = std::min(first, cell);
+    last = cell + 1;
+  }
+  return {first, std::max(first, last)};
+}
+
+/**
+ * Zeroes all pages whose first byte lies in [begin, end), where [begin, end) is a part of
+ * [regionBegin, regionEnd). The part which starts at regionBegin also zeroes the (partial) page at
+ * the beginning of the region. No byte outside of the region is written.
+ */
+inline void touchPages(char* begin, char* end, char* regionBegin, char* regionEnd) {
+  if (begin >= end) {
+    return;
+  }
+  const auto ceilPage = [](char* address) {
+    const std::uintptr_t page = pageSize();
+    return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(address) + page - 1) / page *
+                                   page);
+  };
+  char* first = (begin == regionBegin) ? begin : std::min(ceilPage(begin), regionEnd);
+  char* last = std::min(ceilPage(end), regionEnd);
+  if (first < last) {
+    std::memset(first, 0, last - first);
+  }
+}
+
+/**
+ * Zeroes numberOfCells consecutive items of bytesPerCell bytes with the static schedule.
+ */
+inline void touchCellData(void* memory, std::size_t bytesPerCell, unsigned numberOfCells) {
+  char* region = static_cast<char*>(memory);
+  char* regionEnd = region + bytesPerCell * numberOfCells;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif // _OPENMP
+  {
+    const auto range = staticScheduleRange(numberOfCells);
+    touchPages(region + range.first * bytesPerCell,
+               region + range.second * bytesPerCell,
+               region,
+               regionEnd);
+  }
+}
+
+/**
+ * Counts the pages of [memory, memory + bytes) per NUMA node. Negative keys are the errors
+ * reported by move_pages, e.g. -ENOENT for pages which were not touched yet.
+ * Returns an empty map if SeisSol was compiled without libnuma.
+ */
+std::map<int, std::size_t> pagesPerNumaNode(const void* memory, std::size_t bytes);
+
+} // namespace seissol::parallel
+
+#endif // PARALLEL_FIRSTTOUCH_H_
@@ -0,0 +1,61 @@
+#ifndef PARALLEL_PREFIXSUM_H_
+#define PARALLEL_PREFIXSUM_H_
+
+#include <cstddef>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif // _OPENMP
+
+namespace seissol::parallel {
+
+/**
+ * Computes offsets[i] = count(0) + ... + count(i-1) for i = 0, ..., n with all OpenMP threads.
+ * The sums are exact (integers), hence the result equals the one of a serial loop.
+ *
+ * @param count Called exactly once for every i in [0, n)
+ * @param offsets Array of size n + 1; offsets[n] holds the total
+ */
+template <typename T, typename CountFunction>
+void exclusivePrefixSum(std::size_t n, CountFunction&& count, T* offsets) {
+#ifdef _OPENMP
+  std::vector<T> threadOffsets;
+#pragma omp parallel shared(threadOffsets)
+  {
+    const std::size_t numThreads = omp_get_num_threads();
+    const std::size_t thread = omp_get_thread_num();
+#pragma omp single
+    threadOffsets.assign(numThreads + 1, T(0));
+
+    const std::size_t begin = n * thread / numThreads;
+    const std::size_t end = n * (thread + 1) / numThreads;
+    T sum = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+      offsets[i] = sum;
+      sum += count(i);
+    }
+    threadOffsets[thread + 1] = sum;
+
+#pragma omp barrier
+#pragma omp single
+    for (std::size_t t = 0; t < numThreads; ++t) {
+      threadOffsets[t + 1] += threadOffsets[t];
+    }
+
+    for (std::size_t i = begin; i < end; ++i) {
+      offsets[i] += threadOffsets[thread];
+    }
+  }
+  offsets[n] = threadOffsets.back();
+#else
+  offsets[0] = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    offsets[i + 1] = offsets[i] + count(i);
+  }
+#endif // _OPENMP
+}
+
+} // namespace seissol::parallel
+
+#endif // PARALLEL_PREFIXSUM_H_
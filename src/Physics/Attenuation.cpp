@@ -1,6 +1,12 @@
 #include <cmath>
 #include <cstddef>
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -8,14 +14,29 @@
 
 namespace seissol::physics {
 
-void fitAttenuation(seissol::model::ViscoElasticMaterial& vm,
-                    double freqCentral,
-                    double freqRatio) {
+namespace {
 #if NUMBER_OF_RELAXATION_MECHANISMS > 0
-  constexpr std::size_t nummech = NUMBER_OF_RELAXATION_MECHANISMS;
+constexpr std::size_t nummech = NUMBER_OF_RELAXATION_MECHANISMS;
+
+/**
+ * The part of the attenuation fit which only depends on (Qp, Qs, freqCentral, freqRatio).
+ */
+struct AttenuationFit {
+  std::array<double, nummech> omega;
+  std::array<double, nummech> alpha;
+  std::array<double, nummech> beta;
+  double rp;
+  double psi1p;
+  double rs;
+  double psi1s;
+};
+
+AttenuationFit computeFit(double qp, double qs, double freqCentral, double freqRatio) {
   constexpr std::size_t kmax =
       2 * nummech - 1; // slight note: if nummech == 0, this does not make any sense
 
+  AttenuationFit fit;
+
   const double w0 = 2 * M_PI * freqCentral;
   const double wmin = w0 / std::sqrt(freqRatio);
 
@@ -32,7 +53,7 @@ void fitAttenuation(seissol::model::ViscoElasticMaterial& vm,
   }
 
   for (size_t i = 0; i < nummech; ++i) {
-    vm.omega[i] = w(2 * i);
+    fit.omega[i] = w(2 * i);
   }
 
   Eigen::MatrixXd AP(kmax, nummech);
@@ -44,13 +65,13 @@ void fitAttenuation(seissol::model::ViscoElasticMaterial& vm,
       const double wisq = w(i) * w(i);
       const double norm = wjsq + wisq;
       const double sc1 = w(2 * j) * w(i);
-      AP(i, j) = (sc1 + wjsq / vm.Qp) / norm;
-      AS(i, j) = (sc1 + wjsq / vm.Qs) / norm;
+      AP(i, j) = (sc1 + wjsq / qp) / norm;
+      AS(i, j) = (sc1 + wjsq / qs) / norm;
     }
   }
 
-  Eigen::VectorXd qpinv = Eigen::VectorXd::Constant(kmax, 1 / vm.Qp);
-  Eigen::VectorXd qsinv = Eigen::VectorXd::Constant(kmax, 1 / vm.Qs);
+  Eigen::VectorXd qpinv = Eigen::VectorXd::Constant(kmax, 1 / qp);
+  Eigen::VectorXd qsinv = Eigen::VectorXd::Constant(kmax, 1 / qs);
 
   auto APodc = AP.completeOrthogonalDecomposition();
   auto ASodc = AS.completeOrthogonalDecomposition();
@@ -73,17 +94,29 @@ void fitAttenuation(seissol::model::ViscoElasticMaterial& vm,
     psi2p = psi2p + alpha(i) * (w0dw / w0dwsq1);
     psi1s = psi1s - beta(i) / w0dwsq1;
     psi2s = psi2s + beta(i) * (w0dw / w0dwsq1);
+    fit.alpha[i] = alpha(i);
+    fit.beta[i] = beta(i);
   }
-  const double rp = std::sqrt(psi1p * psi1p + psi2p * psi2p);
-  const double var_p = (vm.lambda + 2 * vm.mu) * (rp + psi1p) / (2 * rp * rp);
-  const double rs = std::sqrt(psi1s * psi1s + psi2s * psi2s);
-  const double var_mu = vm.mu * (rs + psi1s) / (2 * rs * rs);
+  fit.rp = std::sqrt(psi1p * psi1p + psi2p * psi2p);
+  fit.psi1p = psi1p;
+  fit.rs = std::sqrt(psi1s * psi1s + psi2s * psi2s);
+  fit.psi1s = psi1s;
+  return fit;
+}
+
+void applyFit(seissol::model::ViscoElasticMaterial& vm, const AttenuationFit& fit) {
+  for (size_t i = 0; i < nummech; ++i) {
+    vm.omega[i] = fit.omega[i];
+  }
+
+  const double var_p = (vm.lambda + 2 * vm.mu) * (fit.rp + fit.psi1p) / (2 * fit.rp * fit.rp);
+  const double var_mu = vm.mu * (fit.rs + fit.psi1s) / (2 * fit.rs * fit.rs);
   // replace end
 
   const double var_lambda = var_p - 2 * var_mu;
   for (size_t i = 0; i < nummech; ++i) {
-    const double t1 = -var_p * alpha(i);
-    const double t2 = -2.0 * var_mu * beta(i);
+    const double t1 = -var_p * fit.alpha[i];
+    const double t2 = -2.0 * var_mu * fit.beta[i];
     vm.theta[i][0] = t1;
     vm.theta[i][1] = t1 - t2;
     vm.theta[i][2] = t2;
@@ -91,6 +124,66 @@ void fitAttenuation(seissol::model::ViscoElasticMaterial& vm,
 
   vm.mu = var_mu;
   vm.lambda = var_lambda;
+}
+
+// (Qp, Qs), compared bitwise
+using QualityFactorKey = std::pair<std::uint64_t, std::uint64_t>;
+
+struct QualityFactorKeyHash {
+  std::size_t operator()(const QualityFactorKey& key) const {
+    return std::hash<std::uint64_t>()(key.first) ^ (std::hash<std::uint64_t>()(key.second) << 1);
+  }
+};
+
+QualityFactorKey makeKey(const seissol::model::ViscoElasticMaterial& vm) {
+  QualityFactorKey key;
+  std::memcpy(&key.first, &vm.Qp, sizeof(double));
+  std::memcpy(&key.second, &vm.Qs, sizeof(double));
+  return key;
+}
+#endif
+} // namespace
+
+void fitAttenuation(seissol::model::ViscoElasticMaterial& vm,
+                    double freqCentral,
+                    double freqRatio) {
+#if NUMBER_OF_RELAXATION_MECHANISMS > 0
+  applyFit(vm, computeFit(vm.Qp, vm.Qs, freqCentral, freqRatio));
+#endif
+}
+
+void fitAttenuation(std::vector<seissol::model::ViscoElasticMaterial>& materials,
+                    double freqCentral,
+                    double freqRatio) {
+#if NUMBER_OF_RELAXATION_MECHANISMS > 0
+  // Q is usually piecewise constant; hence, we only fit once per unique (Qp, Qs)
+  std::unordered_map<QualityFactorKey, std::size_t, QualityFactorKeyHash> uniqueIndices;
+  std::vector<std::size_t> fitIndices(materials.size());
+  std::vector<std::size_t> representatives;
+  for (std::size_t i = 0; i < materials.size(); ++i) {
+    const auto [it, inserted] =
+        uniqueIndices.try_emplace(makeKey(materials[i]), representatives.size());
+    if (inserted) {
+      representatives.push_back(i);
+    }
+    fitIndices[i] = it->second;
+  }
+
+  std::vector<AttenuationFit> fits(representatives.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (std::size_t j = 0; j < representatives.size(); ++j) {
+    const auto& vm = materials[representatives[j]];
+    fits[j] = computeFit(vm.Qp, vm.Qs, freqCentral, freqRatio);
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t i = 0; i < materials.size(); ++i) {
+    applyFit(materials[i], fits[fitIndices[i]]);
+  }
 #endif
 }
 
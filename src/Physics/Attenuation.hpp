@@ -1,8 +1,18 @@
 
+#include <vector>
+
 #include "Equations/datastructures.hpp"
 
 namespace seissol::physics {
 
 void fitAttenuation(seissol::model::ViscoElasticMaterial& vm, double freqCentral, double freqRatio);
 
+/**
+ * Fits the attenuation for all materials. The fit is computed once per unique (Qp, Qs) pair;
+ * the result is identical to calling the above function for every material.
+ */
+void fitAttenuation(std::vector<seissol::model::ViscoElasticMaterial>& materials,
+                    double freqCentral,
+                    double freqRatio);
+
 }
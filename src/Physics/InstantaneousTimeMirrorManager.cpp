@@ -60,68 +60,46 @@ void InstantaneousTimeMirrorManager::updateVelocities() {
 #else
   auto itmParameters = seissolInstance.getSeisSolParameters().model.itmParameters;
   auto reflectionType = itmParameters.itmReflectionType;
-  for (auto it = ltsTree->beginLeaf(initializer::LayerMask(Ghost)); it != ltsTree->endLeaf();
-       ++it) {
-    CellMaterialData* materials = it->var(lts->material);
 
+  auto scaleMaterial = [&](seissol::model::Material_t& material) {
     if (reflectionType == seissol::initializer::parameters::ReflectionType::BothWaves) {
-      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
-        auto& material = materials[cell];
-        // Refocusing both waves
-        material.local.mu *= velocityScalingFactor * velocityScalingFactor;
-        material.local.lambda *= velocityScalingFactor * velocityScalingFactor;
-        for (int i = 0; i < 4; i++) {
-          material.neighbor[i].mu *= velocityScalingFactor * velocityScalingFactor;
-          material.neighbor[i].lambda *= velocityScalingFactor * velocityScalingFactor;
-        }
-      }
+      // Refocusing both waves
+      material.mu *= velocityScalingFactor * velocityScalingFactor;
+      material.lambda *= velocityScalingFactor * velocityScalingFactor;
     }
 
     if (reflectionType == seissol::initializer::parameters::ReflectionType::BothWavesVelocity) {
-      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
-        auto& material = materials[cell];
-        // Refocusing both waves with constant velocities
-        material.local.lambda *= velocityScalingFactor;
-        material.local.mu *= velocityScalingFactor;
-        material.local.rho *= velocityScalingFactor;
-        for (int i = 0; i < 4; i++) {
-          material.neighbor[i].lambda *= velocityScalingFactor;
-          material.neighbor[i].mu *= velocityScalingFactor;
-          material.neighbor[i].rho *= velocityScalingFactor;
-        }
-      }
+      // Refocusing both waves with constant velocities
+      material.lambda *= velocityScalingFactor;
+      material.mu *= velocityScalingFactor;
+      material.rho *= velocityScalingFactor;
     }
 
     if (reflectionType == seissol::initializer::parameters::ReflectionType::Pwave) {
-      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
-        auto& material = materials[cell];
-        // Refocusing only P-waves
-        material.local.lambda *= velocityScalingFactor * velocityScalingFactor;
-        for (int i = 0; i < 4; i++) {
-          material.neighbor[i].lambda *= velocityScalingFactor * velocityScalingFactor;
-        }
-      }
+      // Refocusing only P-waves
+      material.lambda *= velocityScalingFactor * velocityScalingFactor;
     }
 
     if (reflectionType == seissol::initializer::parameters::ReflectionType::Swave) {
-      for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
-        auto& material = materials[cell];
-        // Refocusing only S-waves
-        material.local.lambda =
-            -2.0 * velocityScalingFactor * material.local.mu +
-            (material.local.lambda + 2.0 * material.local.mu) / velocityScalingFactor;
-        material.local.mu *= velocityScalingFactor;
-        material.local.rho *= velocityScalingFactor;
-
-        for (int i = 0; i < 4; i++) {
-          material.neighbor[i].lambda =
-              -2.0 * velocityScalingFactor * material.neighbor[i].mu +
-              (material.neighbor[i].lambda + 2.0 * material.neighbor[i].mu) / velocityScalingFactor;
-          material.neighbor[i].mu *= velocityScalingFactor;
-          material.neighbor[i].rho *= velocityScalingFactor;
-        }
-      }
+      // Refocusing only S-waves
+      material.lambda = -2.0 * velocityScalingFactor * material.mu +
+                        (material.lambda + 2.0 * material.mu) / velocityScalingFactor;
+      material.mu *= velocityScalingFactor;
+      material.rho *= velocityScalingFactor;
     }
+  };
+
+  // The neighbor materials only reference the local materials of the neighboring cells (or the
+  // ghost materials), hence every material is scaled exactly once.
+  for (auto it = ltsTree->beginLeaf(initializer::LayerMask(Ghost)); it != ltsTree->endLeaf();
+       ++it) {
+    CellMaterialData* materials = it->var(lts->material);
+    for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
+      scaleMaterial(materials[cell].local);
+    }
+  }
+  for (auto& material : seissolInstance.getMemoryManager().getGhostMaterials()) {
+    scaleMaterial(material);
   }
 #endif
 }
@@ -105,54 +105,47 @@ void seissol::solver::FreeSurfaceIntegrator::initialize(  unsigned maxRefinement
 
 void seissol::solver::FreeSurfaceIntegrator::calculateOutput()
 {
-  unsigned offset = 0;
-  seissol::initializer::LayerMask ghostMask(Ghost);
-  for (auto surfaceLayer = surfaceLtsTree.beginLeaf(ghostMask);
-       surfaceLayer != surfaceLtsTree.endLeaf(); ++surfaceLayer) {
-    real** dofs = surfaceLayer->var(surfaceLts.dofs);
-    real** displacementDofs = surfaceLayer->var(surfaceLts.displacementDofs);
-    unsigned* side = surfaceLayer->var(surfaceLts.side);
+  // The surface variables are not stored for the ghost layer. Hence, the tree-wide arrays hold the
+  // faces of all interior and copy layers in the same order as the output.
+  real** dofs = surfaceLtsTree.var(surfaceLts.dofs);
+  real** displacementDofs = surfaceLtsTree.var(surfaceLts.displacementDofs);
+  unsigned* side = surfaceLtsTree.var(surfaceLts.side);
+  const unsigned numberOfFaces = totalNumberOfFreeSurfaces;
 
 #if defined(_OPENMP) && !NVHPC_AVOID_OMP
-    #pragma omp parallel for schedule(static) default(none) shared(offset, surfaceLayer, dofs, displacementDofs, side)
+  #pragma omp parallel for schedule(static) default(none) shared(dofs, displacementDofs, side, numberOfFaces)
 #endif // _OPENMP
-    for (unsigned face = 0; face < surfaceLayer->getNumberOfCells(); ++face) {
-      real subTriangleDofs[tensor::subTriangleDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
-
-      kernel::subTriangleVelocity vkrnl;
-      vkrnl.Q = dofs[face];
-      vkrnl.selectVelocity = init::selectVelocity::Values;
-      vkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[ side[face] ];
-      vkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
-      vkrnl.execute(triRefiner.maxDepth);
-
-      auto addOutput = [&] (real* output[FREESURFACE_NUMBER_OF_COMPONENTS]) {
-        for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
-          real* target = output[component] + offset + face * numberOfSubTriangles;
-          /// @yateto_todo fix for multiple simulations
-          real* source = subTriangleDofs + component * numberOfAlignedSubTriangles; 
-          for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
-            target[subtri] = source[subtri];
-            if (!std::isfinite(source[subtri])) {
-              logError() << "Detected Inf/NaN in free surface output. Aborting.";
-            }
+  for (unsigned face = 0; face < numberOfFaces; ++face) {
+    real subTriangleDofs[tensor::subTriangleDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
+    real subTriangleDisplacementDofs[tensor::subTriangleDisplacementDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
+
+    kernel::subTriangleOutput krnl;
+    krnl.Q = dofs[face];
+    krnl.selectVelocity = init::selectVelocity::Values;
+    krnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[ side[face] ];
+    krnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
+    krnl.faceDisplacement = displacementDofs[face];
+    krnl.MV2nTo2m = nodal::init::MV2nTo2m::Values;
+    krnl.subTriangleProjectionFromFace(triRefiner.maxDepth) = projectionMatrixFromFace.get();
+    krnl.subTriangleDisplacementDofs(triRefiner.maxDepth) = subTriangleDisplacementDofs;
+    krnl.execute(triRefiner.maxDepth);
+
+    auto addOutput = [&] (real* output[FREESURFACE_NUMBER_OF_COMPONENTS], const real* projected) {
+      for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
+        real* target = output[component] + face * numberOfSubTriangles;
+        /// @yateto_todo fix for multiple simulations
+        const real* source = projected + component * numberOfAlignedSubTriangles;
+        for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
+          target[subtri] = source[subtri];
+          if (!std::isfinite(source[subtri])) {
+            logError() << "Detected Inf/NaN in free surface output. Aborting.";
           }
-
         }
-      };
-
-      addOutput(velocities);
-
-      kernel::subTriangleDisplacement dkrnl;
-      dkrnl.faceDisplacement = displacementDofs[face];
-      dkrnl.MV2nTo2m = nodal::init::MV2nTo2m::Values;
-      dkrnl.subTriangleProjectionFromFace(triRefiner.maxDepth) = projectionMatrixFromFace.get();
-      dkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
-      dkrnl.execute(triRefiner.maxDepth);
+      }
+    };
 
-      addOutput(displacements);
-    }
-    offset += surfaceLayer->getNumberOfCells() * numberOfSubTriangles;
+    addOutput(velocities, subTriangleDofs);
+    addOutput(displacements, subTriangleDisplacementDofs);
   }
 }
 
@@ -83,11 +83,15 @@
 #include <Kernels/Receiver.h>
 #include <Monitoring/FlopCounter.hpp>
 #include <Monitoring/instrumentation.hpp>
+#include "utils/env.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <iterator>
 
 #include <generated_code/kernel.h>
+#include <yateto.h>
 
 seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsigned int i_globalClusterId,
                                                  unsigned int profilingId,
@@ -149,8 +153,23 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_neighborKernel.setGlobalData(i_globalData);
   m_dynamicRuptureKernel.setGlobalData(i_globalData);
 
+  // number of DR faces which are interpolated and evaluated in one go (0: separate sweeps)
+  drFusedBlockSize = utils::Env::get<unsigned>("SEISSOL_DR_FUSED_BLOCK_SIZE", 8);
+
   computeFlops();
 
+  // LtsLayout sorts the cells with only regular or periodic faces to the front of the interior
+  const CellLocalInformation* cellInformation = m_clusterData->var(m_lts->cellInformation);
+  auto isRegular = [](FaceType faceType) {
+    return faceType == FaceType::regular || faceType == FaceType::periodic;
+  };
+  while (m_numberOfRegularCells < m_clusterData->getNumberOfCells() &&
+         std::all_of(std::begin(cellInformation[m_numberOfRegularCells].faceTypes),
+                     std::end(cellInformation[m_numberOfRegularCells].faceTypes),
+                     isRegular)) {
+    ++m_numberOfRegularCells;
+  }
+
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
@@ -168,6 +187,47 @@ void seissol::time_stepping::TimeCluster::setPointSources(
   m_sourceCluster = std::move(sourceCluster);
 }
 
+void seissol::time_stepping::TimeCluster::setReceiverCluster(
+    kernels::ReceiverCluster* receiverCluster) {
+  m_receiverCluster = receiverCluster;
+  m_derivativesOutput.clear();
+  if (m_receiverCluster == nullptr || m_receiverCluster->begin() == m_receiverCluster->end() ||
+      !m_receiverCluster->readsStoredDerivatives()) {
+    return;
+  }
+
+  const unsigned numberOfCells = m_clusterData->getNumberOfCells();
+  real (*dofs)[tensor::Q::size()] = m_clusterData->var(m_lts->dofs);
+  real** derivatives = m_clusterData->var(m_lts->derivatives);
+  m_derivativesOutput.assign(derivatives, derivatives + numberOfCells);
+
+  // Cells with derivatives for the LTS scheme already store them in every time step
+  std::vector<unsigned> receiverCells;
+  for (auto& receiver : *m_receiverCluster) {
+    const unsigned cell = (receiver.data.dofs() - dofs[0]) / tensor::Q::size();
+    assert(cell < numberOfCells);
+    if (derivatives[cell] == nullptr) {
+      receiverCells.push_back(cell);
+    }
+  }
+  std::sort(receiverCells.begin(), receiverCells.end());
+  receiverCells.erase(std::unique(receiverCells.begin(), receiverCells.end()), receiverCells.end());
+
+  if (!receiverCells.empty()) {
+    constexpr auto DerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+    real* receiverDerivatives = static_cast<real*>(m_receiverDerivativesAllocator.allocateMemory(
+        receiverCells.size() * DerivativesSize * sizeof(real), ALIGNMENT));
+    for (unsigned i = 0; i < receiverCells.size(); ++i) {
+      m_derivativesOutput[receiverCells[i]] = receiverDerivatives + i * DerivativesSize;
+    }
+  }
+
+  for (auto& receiver : *m_receiverCluster) {
+    const unsigned cell = (receiver.data.dofs() - dofs[0]) / tensor::Q::size();
+    receiver.derivatives = m_derivativesOutput[cell];
+  }
+}
+
 void seissol::time_stepping::TimeCluster::writeReceivers() {
   SCOREP_USER_REGION("writeReceivers", SCOREP_USER_REGION_TYPE_FUNCTION)
 
@@ -218,42 +278,62 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   m_dynamicRuptureKernel.setTimeStepWidth(timeStepSize());
   frictionSolver->computeDeltaT(m_dynamicRuptureKernel.timePoints);
 
+  auto interpolate = [&](unsigned begin, unsigned end) {
+    for (unsigned face = begin; face < end; ++face) {
+      unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+      m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
+                                                    m_globalDataOnHost,
+                                                    &godunovData[face],
+                                                    &drEnergyOutput[face],
+                                                    timeDerivativePlus[face],
+                                                    timeDerivativeMinus[face],
+                                                    qInterpolatedPlus[face],
+                                                    qInterpolatedMinus[face],
+                                                    timeDerivativePlus[prefetchFace],
+                                                    timeDerivativeMinus[prefetchFace]);
+    }
+  };
+
+  if (drFusedBlockSize > 0) {
+    // interpolate and evaluate the friction law on small blocks of faces, while qInterpolated is
+    // still in cache
+    SCOREP_USER_REGION_END(myRegionHandle)
+    SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureFused", SCOREP_USER_REGION_TYPE_COMMON )
+    frictionSolver->evaluateFused(layerData,
+                                  m_dynRup,
+                                  ct.correctionTime,
+                                  m_dynamicRuptureKernel.timeWeights,
+                                  interpolate,
+                                  drFusedBlockSize);
+    SCOREP_USER_REGION_END(myRegionHandle)
+  } else {
 #pragma omp parallel 
-  {
-  LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
-  }
+    {
+    LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
+    }
 #ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
+    #pragma omp parallel for schedule(static)
 #endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
-    unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
-    m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
-                                                  m_globalDataOnHost,
-                                                  &godunovData[face],
-                                                  &drEnergyOutput[face],
-                                                  timeDerivativePlus[face],
-                                                  timeDerivativeMinus[face],
-                                                  qInterpolatedPlus[face],
-                                                  qInterpolatedMinus[face],
-                                                  timeDerivativePlus[prefetchFace],
-                                                  timeDerivativeMinus[prefetchFace]);
-  }
-  SCOREP_USER_REGION_END(myRegionHandle)
+    for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+      interpolate(face, face + 1);
+    }
+    SCOREP_USER_REGION_END(myRegionHandle)
 #pragma omp parallel 
-  {
-  LIKWID_MARKER_STOP("computeDynamicRuptureSpaceTimeInterpolation");
-  LIKWID_MARKER_START("computeDynamicRuptureFrictionLaw");
-  }
+    {
+    LIKWID_MARKER_STOP("computeDynamicRuptureSpaceTimeInterpolation");
+    LIKWID_MARKER_START("computeDynamicRuptureFrictionLaw");
+    }
 
-  SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureFrictionLaw", SCOREP_USER_REGION_TYPE_COMMON )
-  frictionSolver->evaluate(layerData,
-                           m_dynRup,
-                           ct.correctionTime,
-                           m_dynamicRuptureKernel.timeWeights);
-  SCOREP_USER_REGION_END(myRegionHandle)
+    SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureFrictionLaw", SCOREP_USER_REGION_TYPE_COMMON )
+    frictionSolver->evaluate(layerData,
+                             m_dynRup,
+                             ct.correctionTime,
+                             m_dynamicRuptureKernel.timeWeights);
+    SCOREP_USER_REGION_END(myRegionHandle)
 #pragma omp parallel 
-  {
-  LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
+    {
+    LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
+    }
   }
 
   m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_profilingId);
@@ -344,6 +424,9 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
   real** derivatives = i_layerData.var(m_lts->derivatives);
   CellMaterialData* materialData = i_layerData.var(m_lts->material);
 
+  // Also store the derivatives of the receiver cells, if requested
+  real** derivativesOutput = m_derivativesOutput.empty() ? derivatives : m_derivativesOutput.data();
+
   kernels::LocalData::Loader loader;
   loader.load(*m_lts, i_layerData);
   kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
@@ -375,7 +458,7 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
                              data,
                              tmp,
                              l_bufferPointer,
-                             derivatives[l_cell],
+                             derivativesOutput[l_cell],
                              true);
 
     // Compute local integrals (including some boundary conditions)
@@ -699,6 +782,20 @@ void seissol::time_stepping::TimeCluster::computeFlops() {
           m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)],
           m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)]
           );
+
+  // estimated memory traffic: every variable of a cell or fault face is touched once
+  m_bytes[static_cast<int>(ComputePart::Local)] =
+      static_cast<double>(m_timeKernel.bytesAder() + m_localKernel.bytesIntegral()) * m_clusterData->getNumberOfCells();
+  m_bytes[static_cast<int>(ComputePart::Neighbor)] =
+      static_cast<double>(m_neighborKernel.bytesNeighborsIntegral()) * m_clusterData->getNumberOfCells();
+
+  auto* dynRupTree = seissolInstance.getMemoryManager().getDynamicRuptureTree();
+  double bytesPerFace = 2.0 * yateto::computeFamilySize<tensor::dQ>() * sizeof(real);
+  for (unsigned var = 0; var < dynRupTree->getNumberOfVariables(); ++var) {
+    bytesPerFace += dynRupTree->info(var).bytes;
+  }
+  m_bytes[static_cast<int>(ComputePart::DRFrictionLawInterior)] = bytesPerFace * dynRupInteriorData->getNumberOfCells();
+  m_bytes[static_cast<int>(ComputePart::DRFrictionLawCopy)] = bytesPerFace * dynRupCopyData->getNumberOfCells();
 }
 
 namespace seissol::time_stepping {
@@ -732,12 +829,24 @@ void TimeCluster::predict() {
     resetBuffers = true;
   }
 
-  writeReceivers();
+  // Receivers which read the stored derivatives need the local integration of this time step;
+  // otherwise, they need the DOFs before the local integration
+  const bool receiversReadDerivatives = !m_derivativesOutput.empty();
+  if (!receiversReadDerivatives) {
+    writeReceivers();
+  }
   computeLocalIntegration(*m_clusterData, resetBuffers);
+  if (receiversReadDerivatives) {
+    writeReceivers();
+  }
   computeSources();
 
   seissolInstance.flopCounter().incrementNonZeroFlopsLocal(m_flops_nonZero[static_cast<int>(ComputePart::Local)]);
   seissolInstance.flopCounter().incrementHardwareFlopsLocal(m_flops_hardware[static_cast<int>(ComputePart::Local)]);
+  m_loopStatistics->addWork(m_regionComputeLocalIntegration,
+                            m_flops_nonZero[static_cast<int>(ComputePart::Local)],
+                            m_flops_hardware[static_cast<int>(ComputePart::Local)],
+                            m_bytes[static_cast<int>(ComputePart::Local)]);
 }
 void TimeCluster::correct() {
   assert(state == ActorState::Predicted);
@@ -771,12 +880,20 @@ void TimeCluster::correct() {
       computeDynamicRupture(*dynRupInteriorData);
       seissolInstance.flopCounter().incrementNonZeroFlopsDynamicRupture(m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
       seissolInstance.flopCounter().incrementHardwareFlopsDynamicRupture(m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
+      m_loopStatistics->addWork(m_regionComputeDynamicRupture,
+                                m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)],
+                                m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)],
+                                m_bytes[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
       dynamicRuptureScheduler->setLastCorrectionStepsInterior(ct.stepsSinceStart);
     }
     if (layerType == Copy) {
       computeDynamicRupture(*dynRupCopyData);
       seissolInstance.flopCounter().incrementNonZeroFlopsDynamicRupture(m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
       seissolInstance.flopCounter().incrementHardwareFlopsDynamicRupture(m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
+      m_loopStatistics->addWork(m_regionComputeDynamicRupture,
+                                m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)],
+                                m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)],
+                                m_bytes[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
       dynamicRuptureScheduler->setLastCorrectionStepsCopy((ct.stepsSinceStart));
     }
 
@@ -787,6 +904,10 @@ void TimeCluster::correct() {
   seissolInstance.flopCounter().incrementHardwareFlopsNeighbor(m_flops_hardware[static_cast<int>(ComputePart::Neighbor)]);
   seissolInstance.flopCounter().incrementNonZeroFlopsDynamicRupture(m_flops_nonZero[static_cast<int>(ComputePart::DRNeighbor)]);
   seissolInstance.flopCounter().incrementHardwareFlopsDynamicRupture(m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)]);
+  m_loopStatistics->addWork(m_regionComputeNeighboringIntegration,
+                            m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)] + m_flops_nonZero[static_cast<int>(ComputePart::DRNeighbor)],
+                            m_flops_hardware[static_cast<int>(ComputePart::Neighbor)] + m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)],
+                            m_bytes[static_cast<int>(ComputePart::Neighbor)]);
 
   // First cluster calls fault receiver output
   // Call fault output only if both interior and copy parts of DR were computed
@@ -167,6 +167,10 @@ private:
     seissol::initializer::LTS*         m_lts;
     seissol::initializer::DynamicRupture* m_dynRup;
     dr::friction_law::FrictionSolver* frictionSolver;
+    //! block size for the fused interpolation and friction law evaluation (0: not fused)
+    unsigned drFusedBlockSize{0};
+    //! number of leading cells of the layer with only regular or periodic faces (cf. LtsLayout)
+    unsigned m_numberOfRegularCells{0};
     dr::output::OutputManager* faultOutputManager;
 
     std::unique_ptr<kernels::PointSourceCluster> m_sourceCluster;
@@ -184,6 +188,8 @@ private:
 
     long long m_flops_nonZero[static_cast<int>(ComputePart::NUM_COMPUTE_PARTS)];
     long long m_flops_hardware[static_cast<int>(ComputePart::NUM_COMPUTE_PARTS)];
+    //! estimated bytes moved between memory and the caches (for the loop statistics)
+    double m_bytes[static_cast<int>(ComputePart::NUM_COMPUTE_PARTS)]{};
     
     //! Tv parameter for plasticity
     double m_tv;
@@ -201,6 +207,12 @@ private:
 
     kernels::ReceiverCluster* m_receiverCluster;
 
+    //! Output of the time derivatives per cell in the local integration (empty: LTS derivatives)
+    std::vector<real*> m_derivativesOutput;
+
+    //! Derivatives of the receiver cells which do not store them for the LTS scheme
+    seissol::memory::ManagedAllocator m_receiverDerivativesAllocator;
+
     /**
      * Writes the receiver output if applicable (receivers present, receivers have to be written).
      **/
@@ -291,18 +303,10 @@ private:
 #endif
                                                        l_timeIntegrated);
 
-        l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][1] :
-                                      drMapping[l_cell][1].godunov;
-        l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][2] :
-                                      drMapping[l_cell][2].godunov;
-        l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][3] :
-                                      drMapping[l_cell][3].godunov;
-
         // fourth face's prefetches
-        if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
+        if (l_cell + 1 < m_numberOfRegularCells) {
+          l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell+1][0];
+        } else if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
           l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
                                         faceNeighbors[l_cell+1][0] :
                                         drMapping[l_cell+1][0].godunov;
@@ -310,10 +314,31 @@ private:
           l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
         }
 
-        m_neighborKernel.computeNeighborsIntegral( data,
-                                                   drMapping[l_cell],
-                                                   l_timeIntegrated, l_faceNeighbors_prefetch
-        );
+        if (l_cell < m_numberOfRegularCells) {
+          // no face types to check
+          l_faceNeighbors_prefetch[0] = faceNeighbors[l_cell][1];
+          l_faceNeighbors_prefetch[1] = faceNeighbors[l_cell][2];
+          l_faceNeighbors_prefetch[2] = faceNeighbors[l_cell][3];
+
+          m_neighborKernel.computeRegularNeighborsIntegral( data,
+                                                            l_timeIntegrated, l_faceNeighbors_prefetch
+          );
+        } else {
+          l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][1] :
+                                        drMapping[l_cell][1].godunov;
+          l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][2] :
+                                        drMapping[l_cell][2].godunov;
+          l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
+                                        faceNeighbors[l_cell][3] :
+                                        drMapping[l_cell][3].godunov;
+
+          m_neighborKernel.computeNeighborsIntegral( data,
+                                                     drMapping[l_cell],
+                                                     l_timeIntegrated, l_faceNeighbors_prefetch
+          );
+        }
 
         if constexpr (usePlasticity) {
           updateRelaxTime();
@@ -428,9 +453,13 @@ public:
   void setPointSources(std::unique_ptr<kernels::PointSourceCluster> sourceCluster);
   void freePointSources() { m_sourceCluster.reset(nullptr); }
 
-  void setReceiverCluster( kernels::ReceiverCluster* receiverCluster) {
-    m_receiverCluster = receiverCluster;
-  }
+  /**
+   * Sets the cluster's receivers. If the receivers read stored time derivatives, the local
+   * integration additionally writes the derivatives of all receiver cells.
+   *
+   * @param receiverCluster Contains the receivers of this cluster (may be nullptr)
+   */
+  void setReceiverCluster( kernels::ReceiverCluster* receiverCluster);
 
   void setFaultOutputManager(dr::output::OutputManager* outputManager) {
     faultOutputManager = outputManager;
@@ -12,6 +12,7 @@ ${CMAKE_CURRENT_BINARY_DIR}/src/generated_code/init.cpp
 
 src/Checkpoint/Backend.cpp
 src/Checkpoint/Fault.cpp
+src/Checkpoint/GlobalLayout.cpp
 src/Checkpoint/Manager.cpp
 src/Checkpoint/posix/Fault.cpp
 src/Checkpoint/posix/Wavefield.cpp
@@ -21,10 +22,13 @@ src/Common/IntegerMaskParser.cpp
 src/Equations/elastic/Kernels/GravitationalFreeSurfaceBC.cpp
 src/Equations/poroelastic/Model/datastructures.cpp
 
+src/Geometry/BinaryMeshReader.cpp
+src/Geometry/CubeGenerator.cpp
 src/Geometry/MeshReader.cpp
 src/Geometry/MeshTools.cpp
 
 src/Initializer/CellLocalMatrices.cpp
+src/Initializer/CellLocalMatricesCache.cpp
 src/Initializer/GlobalData.cpp
 src/Initializer/InitProcedure/Init.cpp
 src/Initializer/InitProcedure/InitIO.cpp
@@ -77,6 +81,7 @@ src/Numerical_aux/ODEVector.cpp
 src/Numerical_aux/Statistics.cpp
 src/Numerical_aux/Transformation.cpp
 
+src/Parallel/FirstTouch.cpp
 src/Parallel/Pin.cpp
 
 src/Physics/Attenuation.cpp
@@ -193,6 +198,14 @@ if (HDF5)
     )
 endif()
 
+if (ZLIB)
+  target_sources(SeisSol-lib PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/compressed/Codec.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/compressed/Wavefield.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/compressed/Fault.cpp
+    )
+endif()
+
 if (HDF5 AND MPI)
   target_sources(SeisSol-lib PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PartitioningLib.cpp
@@ -206,7 +219,6 @@ if (NETCDF)
   list(APPEND SYCL_DEPENDENT_SRC_FILES ${CMAKE_CURRENT_SOURCE_DIR}/src/SourceTerm/NRFReader.cpp)
   target_sources(SeisSol-lib PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/NetcdfReader.cpp
-    ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/CubeGenerator.cpp
     )
 endif()
 
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "Checkpoint/compressed/Codec.h"
+#include "Kernels/common.hpp"
+#include "generated_code/init.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test::checkpoint {
+
+using namespace seissol::checkpoint::compressed;
+
+TEST_CASE("Compressed checkpoint codec") {
+  constexpr std::uint64_t Count = 1000;
+  std::vector<real> data(Count);
+  for (std::uint64_t i = 0; i < Count; ++i) {
+    data[i] = std::sin(0.01 * i) * (i % 10 < 5 ? 1.0 : 1e-3);
+  }
+
+  std::FILE* tmp = std::tmpfile();
+  REQUIRE(tmp != nullptr);
+  const int file = fileno(tmp);
+
+  SUBCASE("Lossless") {
+    // Small blocks, to test reads across block boundaries
+    Codec codec(64, 1, 0);
+    std::vector<char> section;
+    codec.compress(data.data(), Count, section);
+    Codec::write(file, section);
+
+    REQUIRE(codec.statistics().rawBytes == Count * sizeof(real));
+    REQUIRE(codec.statistics().compressedBytes == section.size());
+
+    std::vector<real> restored(Count);
+    REQUIRE(Codec::read(file, 0, 0, Count, restored.data()) ==
+            static_cast<off_t>(section.size()));
+    REQUIRE(restored == data);
+
+    // Partial read
+    std::vector<real> part(100);
+    Codec::read(file, 0, 120, part.size(), part.data());
+    for (std::size_t i = 0; i < part.size(); ++i) {
+      REQUIRE(part[i] == data[120 + i]);
+    }
+  }
+
+  SUBCASE("Error-bounded") {
+    constexpr double ErrorBound = 1e-4;
+    Codec codec(64, 1, ErrorBound);
+    codec.setLossyPattern({false, true, true});
+    std::vector<char> section;
+    codec.compress(data.data(), Count, section);
+    Codec::write(file, section);
+
+    std::vector<real> restored(Count);
+    Codec::read(file, 0, 0, Count, restored.data());
+    for (std::uint64_t i = 0; i < Count; ++i) {
+      if (i % 3 == 0) {
+        REQUIRE(restored[i] == data[i]);
+      } else {
+        REQUIRE(std::abs(restored[i] - data[i]) <= ErrorBound * std::abs(data[i]));
+      }
+    }
+  }
+
+  std::fclose(tmp);
+}
+
+TEST_CASE("Lossy pattern of the DOFs") {
+  constexpr auto Rank = sizeof(tensor::Q::Shape) / sizeof(tensor::Q::Shape[0]);
+  constexpr auto NumBasisFunctions = tensor::Q::Shape[Rank - 2];
+  constexpr auto NumQuantities = tensor::Q::Shape[Rank - 1];
+#ifdef MULTIPLE_SIMULATIONS
+  constexpr unsigned NumSimulations = tensor::Q::Shape[0];
+#else
+  constexpr unsigned NumSimulations = 1;
+#endif
+
+  const auto pattern = dofsLossyPattern();
+  REQUIRE(pattern.size() == tensor::Q::size());
+
+  // The position of every entry in the (padded) memory layout of Q
+  std::vector<real> position(tensor::Q::size());
+  for (std::size_t i = 0; i < position.size(); ++i) {
+    position[i] = i;
+  }
+  auto view = init::Q::view::create(position.data());
+  auto positionOf = [&](unsigned simulation, unsigned basisFunction, unsigned quantity) {
+#ifdef MULTIPLE_SIMULATIONS
+    return static_cast<std::size_t>(view(simulation, basisFunction, quantity));
+#else
+    return static_cast<std::size_t>(view(basisFunction, quantity));
+#endif
+  };
+
+  for (unsigned simulation = 0; simulation < NumSimulations; ++simulation) {
+    for (unsigned quantity = 0; quantity < NumQuantities; ++quantity) {
+      for (unsigned basisFunction = 0; basisFunction < NumBasisFunctions; ++basisFunction) {
+        REQUIRE(pattern[positionOf(simulation, basisFunction, quantity)] == (basisFunction >= 4));
+      }
+    }
+  }
+
+  // The padding is lossless
+  const auto numLossy = std::count(pattern.begin(), pattern.end(), true);
+  const auto numHighOrder = NumBasisFunctions > 4 ? NumBasisFunctions - 4 : 0;
+  REQUIRE(numLossy == NumSimulations * NumQuantities * numHighOrder);
+
+#ifndef MULTIPLE_SIMULATIONS
+  // Same with the explicit layout (basis functions padded to NUMBER_OF_ALIGNED_BASIS_FUNCTIONS)
+  for (unsigned quantity = 0; quantity < NumQuantities; ++quantity) {
+    for (unsigned basisFunction = 0; basisFunction < 4; ++basisFunction) {
+      REQUIRE(!pattern[basisFunction + NUMBER_OF_ALIGNED_BASIS_FUNCTIONS * quantity]);
+    }
+  }
+#endif
+
+  // The constant and linear modes of all cells are restored exactly
+  constexpr unsigned NumCells = 5;
+  std::vector<real> dofs(NumCells * tensor::Q::size());
+  for (std::size_t i = 0; i < dofs.size(); ++i) {
+    dofs[i] = std::sin(0.1 * i) + 2;
+  }
+
+  std::FILE* tmp = std::tmpfile();
+  REQUIRE(tmp != nullptr);
+  Codec codec(64, 1, 1e-2);
+  codec.setLossyPattern(pattern);
+  std::vector<char> section;
+  codec.compress(dofs.data(), dofs.size(), section);
+  Codec::write(fileno(tmp), section);
+
+  std::vector<real> restored(dofs.size());
+  Codec::read(fileno(tmp), 0, 0, dofs.size(), restored.data());
+  for (unsigned cell = 0; cell < NumCells; ++cell) {
+    for (unsigned simulation = 0; simulation < NumSimulations; ++simulation) {
+      for (unsigned quantity = 0; quantity < NumQuantities; ++quantity) {
+        for (unsigned basisFunction = 0; basisFunction < 4 && basisFunction < NumBasisFunctions;
+             ++basisFunction) {
+          const auto i = cell * tensor::Q::size() + positionOf(simulation, basisFunction, quantity);
+          REQUIRE(restored[i] == dofs[i]);
+        }
+      }
+    }
+  }
+
+  std::fclose(tmp);
+}
+
+} // namespace seissol::unit_test::checkpoint
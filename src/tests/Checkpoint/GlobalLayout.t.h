@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Checkpoint/GlobalLayout.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::unit_test::checkpoint {
+
+using namespace seissol::checkpoint;
+
+TEST_CASE("Partition-independent checkpoint layout") {
+  const std::uint64_t offset = 10 * seissol::MPI::mpi.rank();
+  // The key 2 is duplicated
+  const std::vector<std::uint64_t> keys{offset + 5, offset + 2, offset + 9, offset + 2, offset};
+  const std::vector<real> local{50, 51, 20, 21, 90, 91, 20, 21, 0, 1};
+
+  GlobalLayout layout;
+  layout.init(keys, 2);
+
+  std::vector<real> chunk(2 * layout.numberOfChunkItems(), -1);
+  layout.gather(local.data(), chunk.data());
+
+  if (seissol::MPI::mpi.size() == 1) {
+    // Every key is stored once, sorted by key
+    REQUIRE(layout.numberOfChunkItems() == 4);
+    REQUIRE(chunk == std::vector<real>{0, 1, 20, 21, 50, 51, 90, 91});
+  }
+
+  // Duplicates are restored as well
+  std::vector<real> restored(local.size(), -1);
+  layout.scatter(chunk.data(), restored.data());
+  REQUIRE(restored == local);
+}
+
+TEST_CASE("Partition-independent checkpoint with a different partitioning") {
+  const std::uint64_t offset = 10 * seissol::MPI::mpi.rank();
+
+  // Simulates a partitioning on this rank: the keys of all partitions are concatenated
+  auto partitionedKeys = [&](const std::vector<std::vector<std::uint64_t>>& partitions) {
+    std::vector<std::uint64_t> keys;
+    for (const auto& partition : partitions) {
+      for (const auto key : partition) {
+        keys.push_back(offset + key);
+      }
+    }
+    return keys;
+  };
+  auto itemsOf = [](const std::vector<std::uint64_t>& keys) {
+    std::vector<real> items;
+    for (const auto key : keys) {
+      items.push_back(2 * key);
+      items.push_back(2 * key + 1);
+    }
+    return items;
+  };
+
+  // Written with two partitions
+  const auto writtenKeys = partitionedKeys({{3, 0, 7}, {1, 4, 2, 5, 6}});
+  GlobalLayout writeLayout;
+  writeLayout.init(writtenKeys, 2);
+  const auto written = itemsOf(writtenKeys);
+  std::vector<real> chunk(2 * writeLayout.numberOfChunkItems(), -1);
+  writeLayout.gather(written.data(), chunk.data());
+
+  // Loaded with three partitions (the key 1 is duplicated)
+  const auto loadedKeys = partitionedKeys({{6, 2}, {5, 0, 4}, {7, 1, 3, 1}});
+  GlobalLayout loadLayout;
+  loadLayout.init(loadedKeys, 2);
+  REQUIRE(loadLayout.numberOfChunkItems() == writeLayout.numberOfChunkItems());
+
+  // The file content does not depend on the partitioning
+  const auto loaded = itemsOf(loadedKeys);
+  std::vector<real> loadedChunk(chunk.size(), -1);
+  loadLayout.gather(loaded.data(), loadedChunk.data());
+  REQUIRE(loadedChunk == chunk);
+
+  std::vector<real> restored(loaded.size(), -1);
+  loadLayout.scatter(chunk.data(), restored.data());
+  REQUIRE(restored == loaded);
+}
+
+TEST_CASE("Key order of partition-independent checkpoints") {
+  // File order keys can be loaded with any number of partitions
+  REQUIRE(GlobalLayout::isCompatible(KeyOrder::File, 2, KeyOrder::File, 2));
+  REQUIRE(GlobalLayout::isCompatible(KeyOrder::File, 2, KeyOrder::File, 3));
+
+  // Rank order keys only with the same number of partitions
+  REQUIRE(GlobalLayout::isCompatible(KeyOrder::Rank, 2, KeyOrder::Rank, 2));
+  REQUIRE_FALSE(GlobalLayout::isCompatible(KeyOrder::Rank, 2, KeyOrder::Rank, 3));
+
+  // The numbering must not change
+  REQUIRE_FALSE(GlobalLayout::isCompatible(KeyOrder::File, 2, KeyOrder::Rank, 2));
+  REQUIRE_FALSE(GlobalLayout::isCompatible(KeyOrder::Rank, 2, KeyOrder::File, 2));
+}
+
+} // namespace seissol::unit_test::checkpoint
@@ -0,0 +1,7 @@
+#include "doctest.h"
+
+#include "GlobalLayout.t.h"
+
+#ifdef USE_ZLIB
+#include "Codec.t.h"
+#endif // USE_ZLIB
@@ -1,5 +1,6 @@
 #include "tests/TestHelper.h"
 #include <cstdlib>
+#include <vector>
 
 #include <Equations/datastructures.hpp>
 #include <Physics/Attenuation.hpp>
@@ -48,4 +49,37 @@ TEST_CASE("Attenuation") {
          "only.");
   }
 }
+
+TEST_CASE("Batched attenuation") {
+  const double freqCentral = 0.3;
+  const double freqRatio = 100;
+
+  std::vector<seissol::model::ViscoElasticMaterial> materials(6);
+  const double qs[] = {29.20256062985925283, 50.0, 29.20256062985925283};
+  for (std::size_t i = 0; i < materials.size(); ++i) {
+    materials[i].rho = 2787.216864690955845;
+    materials[i].mu = 30969716301.94932938 + i * 1.0e8;
+    materials[i].lambda = 30969716301.94934082 - i * 1.0e8;
+    materials[i].Qs = qs[i % 3];
+    materials[i].Qp = 2.0 * materials[i].Qs;
+  }
+
+  auto expected = materials;
+  for (auto& vm : expected) {
+    seissol::physics::fitAttenuation(vm, freqCentral, freqRatio);
+  }
+  seissol::physics::fitAttenuation(materials, freqCentral, freqRatio);
+
+  // the batched fit needs to give exactly the same result
+  for (std::size_t i = 0; i < materials.size(); ++i) {
+    REQUIRE(materials[i].mu == expected[i].mu);
+    REQUIRE(materials[i].lambda == expected[i].lambda);
+    for (std::size_t mech = 0; mech < NUMBER_OF_RELAXATION_MECHANISMS; ++mech) {
+      REQUIRE(materials[i].omega[mech] == expected[i].omega[mech]);
+      for (std::size_t j = 0; j < 3; ++j) {
+        REQUIRE(materials[i].theta[mech][j] == expected[i].theta[mech][j]);
+      }
+    }
+  }
+}
 } // namespace seissol::unit_test